@@ -9,11 +9,11 @@ namespace FieaGameEngine
 
 	std::string Action::Name() const
 	{
-		return m_Name;
+		return GetPrescribed<s_NameSlot>().Get<std::string>();
 	}
 
 	void Action::SetName(const std::string& name)
 	{
-		m_Name = name;
+		GetPrescribed<s_NameSlot>() = name;
 	}
 }
\ No newline at end of file
@@ -57,6 +57,11 @@ namespace FieaGameEngine
 		/// <param name="name">the name of the action</param>
 		void SetName(const std::string& name);
 
+		/// <summary>
+		/// the slot of m_Name, which every action lists first in its signatures
+		/// </summary>
+		static constexpr size_t s_NameSlot = 1;
+
 	protected:
 		/// <summary>
 		/// protected action constructor
@@ -67,6 +72,7 @@ namespace FieaGameEngine
 
 		/// <summary>
 		/// the name of the action
+		/// only read through its datum, since it isn't used when the type is stored in columns
 		/// </summary>
 		std::string m_Name;
 	};
@@ -19,22 +19,22 @@ namespace FieaGameEngine
 
 	const std::string& ActionCreateAction::Prototype() const
 	{
-		return m_Prototype;
+		return GetPrescribed<s_PrototypeSlot>().Get<std::string>();
 	}
 
 	void ActionCreateAction::SetPrototype(const std::string& prototype)
 	{
-		m_Prototype = prototype;
+		GetPrescribed<s_PrototypeSlot>() = prototype;
 	}
 
 	const std::string& ActionCreateAction::ActionName() const
 	{
-		return m_ActionName;
+		return GetPrescribed<s_ActionNameSlot>().Get<std::string>();
 	}
 
 	void ActionCreateAction::SetActionName(const std::string& actionName)
 	{
-		m_ActionName = actionName;
+		GetPrescribed<s_ActionNameSlot>() = actionName;
 	}
 
 	ActionCreateAction* ActionCreateAction::Clone()
@@ -49,6 +49,6 @@ namespace FieaGameEngine
 			throw std::runtime_error("ActionCreateAction must have a parent");
 		}
 
-		worldState.m_CreateList.PushBack(WorldState::ActionInfo::ActionInfo(m_ActionName, m_Parent, m_Prototype));
+		worldState.m_CreateList.PushBack(WorldState::ActionInfo(ActionName(), m_Parent, Prototype()));
 	}
 }
@@ -87,14 +87,26 @@ namespace FieaGameEngine
 		/// <returns>signatures for actionCreateAction</returns>
 		static const Vector<Signature> Signatures();
 
+		/// <summary>
+		/// the slot of m_Prototype, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_PrototypeSlot = 2;
+
+		/// <summary>
+		/// the slot of m_ActionName, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_ActionNameSlot = 3;
+
 	private:
 		/// <summary>
 		/// the name of the prototype to be created
+		/// only read through its datum, since it isn't used when the type is stored in columns
 		/// </summary>
 		std::string m_Prototype;
 
 		/// <summary>
 		/// the name to be given to the action when it is created
+		/// only read through its datum, since it isn't used when the type is stored in columns
 		/// </summary>
 		std::string m_ActionName;
 	};
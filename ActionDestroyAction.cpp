@@ -18,12 +18,12 @@ namespace FieaGameEngine
 
 	const std::string& ActionDestroyAction::ActionName() const
 	{
-		return m_ActionName;
+		return GetPrescribed<s_ActionNameSlot>().Get<std::string>();
 	}
 
 	void ActionDestroyAction::SetActionName(const std::string& actionName)
 	{
-		m_ActionName = actionName;
+		GetPrescribed<s_ActionNameSlot>() = actionName;
 	}
 
 	ActionDestroyAction* ActionDestroyAction::Clone()
@@ -38,7 +38,7 @@ namespace FieaGameEngine
 			throw std::runtime_error("ActionDestroyAction must have a parent");
 		}
 
-		worldState.m_DestroyList.PushBack(WorldState::ActionInfo::ActionInfo(m_ActionName, m_Parent));
+		worldState.m_DestroyList.PushBack(WorldState::ActionInfo(ActionName(), m_Parent));
 	}
 }
 
@@ -73,9 +73,15 @@ namespace FieaGameEngine
 		/// <returns>the signatures for actiondestroyaction</returns>
 		static const Vector<Signature> Signatures();
 
+		/// <summary>
+		/// the slot of m_ActionName, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_ActionNameSlot = 2;
+
 	private:
 		/// <summary>
 		/// the name of the action to be destroyed
+		/// only read through its datum, since it isn't used when the type is stored in columns
 		/// </summary>
 		std::string m_ActionName;
 	};
@@ -1,14 +1,20 @@
 #include "pch.h"
 #include "ActionEvent.h"
 #include "EventMessageAttributed.h"
-#include "Event.h"
+#include "EventPool.h"
 #include <memory>
 
 namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(ActionEvent);
 
-	ActionEvent::ActionEvent(EventQueue* eventQueue) : Action(TypeIdInstance()), m_EventQueue(eventQueue) {}
+	ActionEvent::ActionEvent(EventQueue* eventQueue) : Action(TypeIdInstance())
+	{
+		if (eventQueue != nullptr)
+		{
+			SetEventQueue(*eventQueue);
+		}
+	}
 
 	const Vector<Signature> ActionEvent::Signatures()
 	{
@@ -28,55 +34,58 @@ namespace FieaGameEngine
 
 	EventQueue* ActionEvent::GetEventQueue() const
 	{
-		return m_EventQueue;
+		return static_cast<EventQueue*>(GetPrescribed<s_EventQueueSlot>().Get<RTTI*>());
 	}
 
 	void ActionEvent::SetEventQueue(EventQueue& eventQueue)
 	{
-		m_EventQueue = &eventQueue;
+		GetPrescribed<s_EventQueueSlot>() = static_cast<RTTI*>(&eventQueue);
 	}
 
 	const std::string& ActionEvent::GetSubtype() const
 	{
-		return m_Subtype;
+		return GetPrescribed<s_SubtypeSlot>().Get<std::string>();
 	}
 
 	void ActionEvent::SetSubtype(const std::string& subtype)
 	{
-		m_Subtype = subtype;
+		GetPrescribed<s_SubtypeSlot>() = subtype;
 	}
 
 	const int ActionEvent::GetDelay() const
 	{
-		return m_Delay;
+		return GetPrescribed<s_DelaySlot>().Get<int>();
 	}
 
 	void ActionEvent::SetDelay(int delay)
 	{
-		m_Delay = delay;
+		GetPrescribed<s_DelaySlot>() = delay;
 	}
 
 	void ActionEvent::Update(WorldState& worldState)
 	{
 		worldState.m_CurrentAction = this;
-		if (m_EventQueue == nullptr)
+		EventQueue* eventQueue = GetEventQueue();
+		if (eventQueue == nullptr)
 		{
 			throw std::runtime_error("event queue cannot be null");
 		}
 
-		EventMessageAttributed message;
-		message.SetSubtype(m_Subtype);
-		message.SetWorldState(worldState);
+		shared_ptr<Event<EventMessageAttributed>> event = EventPool<EventMessageAttributed>::Acquire();
+
+		EventMessageAttributed& message = event->Message();
+		message.ClearAuxiliaryAttributes();
+		message.SetSubtype(GetSubtype());
+		message.SetWorldState((worldState.m_FrameState != nullptr) ? *worldState.m_FrameState : worldState);
 
-		for (auto& pair : AuxiliaryAttributes())
+		const Vector<MapPairType*>& attributes = Attributes();
+		for (size_t i = AuxiliaryBegin(); i < attributes.Size(); ++i)
 		{
-			Datum& datum = message.AppendAuxiliaryAttribute(pair->first);
-			datum = pair->second;
+			Datum& datum = message.AppendAuxiliaryAttribute(attributes[i]->first);
+			datum = attributes[i]->second;
 		}
 
-		shared_ptr<Event<EventMessageAttributed>> event = make_shared<Event<EventMessageAttributed>>(message);
-
-		m_EventQueue->Enqueue(event, std::chrono::milliseconds(m_Delay));
+		eventQueue->Enqueue(std::move(event), std::chrono::milliseconds(GetDelay()), worldState.m_OrderKey);
 		worldState.m_CurrentAction = nullptr;
 
 	}
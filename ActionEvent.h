@@ -26,10 +26,16 @@ namespace FieaGameEngine
 
 		static const Vector<Signature> Signatures();
 
+		//the slots of the members, which have to match their places in Signatures
+		static constexpr size_t s_SubtypeSlot = 2;
+		static constexpr size_t s_DelaySlot = 3;
+		static constexpr size_t s_EventQueueSlot = 4;
+
 	private:
+		//only read through their datums, since they aren't used when the type is stored in columns
 		std::string m_Subtype;
 		int m_Delay = 0;
-		EventQueue* m_EventQueue;
+		EventQueue* m_EventQueue = nullptr;
 	};
 
 	ConcreteFactory(ActionEvent, Scope)
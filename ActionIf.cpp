@@ -5,6 +5,9 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(ActionIf);
 
+	static const Key s_ThenKey("m_Then");
+	static const Key s_ElseKey("m_Else");
+
 	ActionIf::ActionIf() : Action(TypeIdInstance()) {};
 
 	const Vector<Signature> ActionIf::Signatures()
@@ -25,12 +28,12 @@ namespace FieaGameEngine
 
 	int ActionIf::Condition() const
 	{
-		return m_Condition;
+		return GetPrescribed<s_ConditionSlot>().Get<int>();
 	}
 
 	void ActionIf::SetCondition(int condition)
 	{
-		m_Condition = condition;
+		GetPrescribed<s_ConditionSlot>() = condition;
 	}
 
 	void ActionIf::Update(WorldState& worldState)
@@ -39,13 +42,13 @@ namespace FieaGameEngine
 
 		Datum* actions = nullptr;
 
-		if (m_Condition)
+		if (Condition())
 		{
-			actions = &(*Find("m_Then"));
+			actions = &(*Find(s_ThenKey));
 		}
 		else
 		{
-			actions = &(*Find("m_Else"));
+			actions = &(*Find(s_ElseKey));
 		}
 
 		for (size_t i = 0; i < actions->Size(); ++i)
@@ -74,9 +74,15 @@ namespace FieaGameEngine
 		/// <returns></returns>
 		static const Vector<Signature> Signatures();
 
+		/// <summary>
+		/// the slot of m_Condition, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_ConditionSlot = 2;
+
 	private:
 		/// <summary>
 		/// the condition to act upon
+		/// only read through its datum, since it isn't used when the type is stored in columns
 		/// </summary>
 		int m_Condition = 0;
 	};
@@ -5,7 +5,11 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(ActionIncrement);
 
-	ActionIncrement::ActionIncrement() : Action(TypeIdInstance()) {};
+	ActionIncrement::ActionIncrement() : Action(TypeIdInstance())
+	{
+		//a row in the columns starts out zeroed, so the default step has to be set through its datum
+		SetStep(1.0f);
+	}
 
 	const Vector<Signature> ActionIncrement::Signatures()
 	{
@@ -24,42 +28,65 @@ namespace FieaGameEngine
 
 	const std::string& ActionIncrement::Target() const
 	{
-		return m_Target;
+		return GetPrescribed<s_TargetSlot>().Get<std::string>();
 	}
 
 	void ActionIncrement::SetTarget(const std::string& target)
 	{
-		m_Target = target;
+		GetPrescribed<s_TargetSlot>() = target;
 	}
 
 	float ActionIncrement::Step() const
 	{
-		return m_Step;
+		return GetPrescribed<s_StepSlot>().Get<float>();
 	}
 
 	void ActionIncrement::SetStep(float step)
 	{
-		m_Step = step;
+		GetPrescribed<s_StepSlot>() = step;
 	}
 
 	void ActionIncrement::Update(WorldState& worldState)
 	{
 		worldState.m_CurrentAction = this;
 
-		IncrementTarget();
+		IncrementTarget(worldState);
 
 		worldState.m_CurrentAction = nullptr;
 	}
 
-	void ActionIncrement::IncrementTarget()
+	void ActionIncrement::IncrementTarget(WorldState& worldState)
+	{
+		float& target = ResolveTarget().Get<float>();
+
+		if (worldState.m_BatchIncrements)
+		{
+			worldState.m_IncrementTargets.PushBack(&target);
+			worldState.m_IncrementSteps.PushBack(Step());
+		}
+		else
+		{
+			target += Step();
+		}
+	}
+
+	Datum& ActionIncrement::ResolveTarget()
 	{
-		auto [targetDatum, targetScope] = Search(m_Target);
+		const std::string& target = Target();
+
+		//a string that was never interned can't be found, but it can be interned later, so keep looking it up until it is
+		if (m_TargetKey.IsNull() || m_TargetKey.Name() != target)
+		{
+			m_TargetKey = Key::Find(target);
+		}
+
+		auto [targetDatum, targetScope] = m_TargetRef.Resolve(*this, m_TargetKey);
 
 		if (targetScope == nullptr)
 		{
 			throw runtime_error("target not found");
 		}
 
-		*targetDatum = targetDatum->Get<float>() + m_Step;
+		return *targetDatum;
 	}
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "Action.h"
 #include "Factory.h"
+#include "ResolvedRef.h"
 #include "Signature.h"
 
 namespace FieaGameEngine
@@ -66,6 +67,7 @@ namespace FieaGameEngine
 
 		/// <summary>
 		/// goes to the target and increments it by the step
+		/// if the world state batches increments, the target and step are added to its batch instead
 		/// </summary>
 		/// <param name="worldState">the worldstate to increment the target by</param>
 		void Update(WorldState& worldState) override;
@@ -76,22 +78,53 @@ namespace FieaGameEngine
 		/// <returns>signatures for actionincrement</returns>
 		static const Vector<Signature> Signatures();
 
+		/// <summary>
+		/// the slot of m_Target, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_TargetSlot = 2;
+
+		/// <summary>
+		/// the slot of m_Step, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_StepSlot = 3;
+
 	private:
 		/// <summary>
-		/// helper function that increments the target
+		/// helper function that increments the target, or batches the increment
 		/// </summary>
-		void IncrementTarget();
+		/// <param name="worldState">the world state holding the batch</param>
+		void IncrementTarget(WorldState& worldState);
+
+		/// <summary>
+		/// returns the datum the target names, searching for it only if the target or a scope on the way to it changed since the last search
+		/// </summary>
+		/// <returns>the target datum</returns>
+		/// <exception cref="runtime_error">throws an exception if the target isn't found</exception>
+		Datum& ResolveTarget();
 
 		/// <summary>
 		/// the target to increment
+		/// only read through its datum, since it isn't used when the type is stored in columns
 		/// </summary>
 		std::string m_Target;
 
 		/// <summary>
 		/// the step to increment the target by
+		/// only read through its datum, since it isn't used when the type is stored in columns
 		/// </summary>
 		float m_Step = 1.0f;
 
+		/// <summary>
+		/// the interned target, looked up again only when the target changes
+		/// </summary>
+		Key m_TargetKey;
+
+		/// <summary>
+		/// the last search for the target
+		/// a copy keeps it too, which is fine since it only matches searches starting from the action it was made for
+		/// </summary>
+		ResolvedRef m_TargetRef;
+
 	};
 
 	ConcreteFactory(ActionIncrement, Scope);
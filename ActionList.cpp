@@ -5,6 +5,8 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(ActionList);
 
+	static const Key s_ActionsKey("m_Actions");
+
 	ActionList::ActionList(RTTI::IdType id) : Action(id) {}
 
 	ActionList::ActionList() : Action(TypeIdInstance()) {}
@@ -25,7 +27,8 @@ namespace FieaGameEngine
 
 	Datum& ActionList::Actions()
 	{
-		return *Find("m_Actions");
+		assert(m_Order[s_ActionsSlot]->first == s_ActionsKey);
+		return GetPrescribed<s_ActionsSlot>();
 	}
 
 	void ActionList::Update(WorldState& worldState)
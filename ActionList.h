@@ -70,6 +70,11 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <returns>the signatures for actionlist</returns>
 		static const Vector<Signature> Signatures();
+
+		/// <summary>
+		/// the slot of m_Actions, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_ActionsSlot = 2;
 	};
 
 	ConcreteFactory(ActionList, Scope);
@@ -6,28 +6,38 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(Attributed);
 
+	static const Key s_ThisKey("this");
+
 	Attributed::Attributed(RTTI::IdType id)
 	{
-		(*this)["this"] = this;
+		Append(s_ThisKey) = this;
 		Populate(id);
 	}
 
 	Attributed::Attributed(const Attributed& toCopy) : Scope(toCopy)
 	{
+		CopyRow(toCopy);
 		UpdatePointers(toCopy);
 	}
 
 	Attributed::Attributed(Attributed&& toMove) noexcept : Scope(std::move(toMove))
 	{
+		TakeRow(toMove);
 		UpdatePointers(toMove);
 	}
 
+	Attributed::~Attributed()
+	{
+		ReleaseRow();
+	}
+
 	Attributed& Attributed::operator=(const Attributed& toCopy)
 	{
 		if (this != &toCopy)
 		{
 			Clear();
 			Scope::operator=(toCopy);
+			CopyRow(toCopy);
 			UpdatePointers(toCopy);
 		}
 		return *this;
@@ -39,6 +49,7 @@ namespace FieaGameEngine
 		{
 			Clear();
 			Scope::operator=(std::move(toMove));
+			TakeRow(toMove);
 			UpdatePointers(toMove);
 		}
 		return *this;
@@ -46,13 +57,20 @@ namespace FieaGameEngine
 
 	void Attributed::Populate(RTTI::IdType id)
 	{
-		Vector<Signature> signatures = TypeManager::GetSignatures(id);
+		const Vector<Signature>& signatures = TypeManager::GetSignatures(id);
+
+		m_Columns = TypeManager::Columns(id);
+		if (m_Columns != nullptr)
+		{
+			m_Row = m_Columns->Acquire();
+		}
 
 		for (const Signature& signature : signatures)
 		{
 			assert(signature.m_Type != Datum::DatumTypes::UNKNOWN);
 
 			Datum& datum = Append(signature.m_Name);
+			assert(m_Order.Size() == signature.m_Slot + 1);
 
 			if (signature.m_Type == Datum::DatumTypes::TABLE)
 			{
@@ -65,8 +83,7 @@ namespace FieaGameEngine
 			}
 			else
 			{
-				void* data = reinterpret_cast<std::uint8_t*>(this) + signature.m_Offset;
-				datum.SetStorage(data, signature.m_Size, signature.m_Type);
+				datum.SetStorage(StorageOf(signature), signature.m_Size, signature.m_Type);
 			}
 		}
 	}
@@ -83,15 +100,7 @@ namespace FieaGameEngine
 			return true;
 		}
 
-		for (Signature& signature : TypeManager::GetSignatures(TypeIdInstance()))
-		{
-			if (key == signature.m_Name)
-			{
-				return true;
-			}
-		}
-
-		return false;
+		return (TypeManager::FindSignature(TypeIdInstance(), key) != nullptr);
 	}
 
 	bool Attributed::IsAuxiliaryAttribute(KeyType& key)
@@ -116,7 +125,7 @@ namespace FieaGameEngine
 
 	const Vector<Attributed::MapPairType*> Attributed::PrescribedAttributes()
 	{
-		Vector<Signature> signatures = TypeManager::GetSignatures(TypeIdInstance());
+		const Vector<Signature>& signatures = TypeManager::GetSignatures(TypeIdInstance());
 		Vector<MapPairType*> vector;
 		
 		for (size_t i = 0; i < (signatures.Size() + 1); ++i)
@@ -129,10 +138,9 @@ namespace FieaGameEngine
 
 	const Vector<Attributed::MapPairType*> Attributed::AuxiliaryAttributes() const
 	{
-		Vector<Signature> signatures = TypeManager::GetSignatures(TypeIdInstance());
 		Vector<MapPairType*> vector;
 
-		for (size_t i = (signatures.Size() + 1); i < m_Order.Size(); ++i)
+		for (size_t i = AuxiliaryBegin(); i < m_Order.Size(); ++i)
 		{
 			vector.PushBack(m_Order[i]);
 		}
@@ -140,21 +148,79 @@ namespace FieaGameEngine
 		return vector;
 	}
 
+	size_t Attributed::AuxiliaryBegin() const
+	{
+		return TypeManager::GetSignatures(TypeIdInstance()).Size() + 1;
+	}
 
+	void Attributed::ClearAuxiliaryAttributes()
+	{
+		Truncate(AuxiliaryBegin());
+	}
+
+	size_t Attributed::Row() const
+	{
+		return m_Row;
+	}
 
 	void Attributed::UpdatePointers(const Attributed& other)
 	{
-		(*this)["this"] = this;
-		Vector<Signature> signatures = TypeManager::GetSignatures(other.TypeIdInstance());
+		GetPrescribed<s_ThisSlot>() = this;
+		const Vector<Signature>& signatures = TypeManager::GetSignatures(other.TypeIdInstance());
 
 		for (const Signature& signature : signatures)
 		{
 			if (signature.m_Type != Datum::DatumTypes::TABLE)
 			{
-				Datum* datum = Find(signature.m_Name);
-				void* data = reinterpret_cast<std::uint8_t*>(this) + signature.m_Offset;
-				datum->SetStorage(data, signature.m_Size, signature.m_Type);
+				Datum& datum = GetPrescribed(signature.m_Slot);
+				datum.SetStorage(StorageOf(signature), signature.m_Size, signature.m_Type);
+			}
+		}
+	}
+
+	void* Attributed::StorageOf(const Signature& signature)
+	{
+		if (m_Columns != nullptr && m_Columns->HasColumn(signature.m_Slot))
+		{
+			return m_Columns->Data(signature.m_Slot, m_Row);
+		}
+
+		return reinterpret_cast<std::uint8_t*>(this) + signature.m_Offset;
+	}
+
+	void Attributed::CopyRow(const Attributed& other)
+	{
+		if (m_Columns != other.m_Columns)
+		{
+			ReleaseRow();
+			if (other.m_Columns != nullptr)
+			{
+				m_Columns = other.m_Columns;
+				m_Row = m_Columns->Acquire();
 			}
 		}
+
+		if (m_Columns != nullptr)
+		{
+			m_Columns->CopyRow(other.m_Row, m_Row);
+		}
+	}
+
+	void Attributed::TakeRow(Attributed& other)
+	{
+		ReleaseRow();
+
+		m_Columns = other.m_Columns;
+		m_Row = other.m_Row;
+		other.m_Columns = nullptr;
+	}
+
+	void Attributed::ReleaseRow()
+	{
+		if (m_Columns != nullptr)
+		{
+			m_Columns->Release(m_Row);
+			m_Columns = nullptr;
+		}
 	}
-}
\ No newline at end of file
+}
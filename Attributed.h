@@ -1,13 +1,18 @@
 #pragma once
 #include "Scope.h"
+#include "Signature.h"
 #include "Vector.h"
 
 namespace FieaGameEngine
 {
+	class ColumnStore;
+
 	/// <summary>
 	/// Attributed class
 	/// based on the signature of a child class, populates a scope with mirroring elements
 	/// cannot be directly implemented, must be inherited from
+	/// a type registered with TypeManager::Storage::Columns keeps its prescribed attributes in a row of its type's ColumnStore
+	/// instead of in its members
 	/// </summary>
 	class Attributed : public Scope
 	{
@@ -31,9 +36,9 @@ namespace FieaGameEngine
 
 		/// <summary>
 		/// destructor for attributed
-		/// marked pure virtual
+		/// marked pure virtual, gives back its row if its type is stored in columns
 		/// </summary>
-		virtual ~Attributed() = 0 {};
+		virtual ~Attributed() = 0;
 
 		/// <summary>
 		/// copy assignment operator for Attributed
@@ -97,6 +102,59 @@ namespace FieaGameEngine
 		/// <returns>a vector of the auxiliary attributes</returns>
 		const Vector<MapPairType*> AuxiliaryAttributes() const;
 
+		/// <summary>
+		/// returns the index in Attributes() of the first auxiliary attribute, so they can be walked without copying them out
+		/// </summary>
+		/// <returns>the index of the first auxiliary attribute</returns>
+		size_t AuxiliaryBegin() const;
+
+		/// <summary>
+		/// removes every auxiliary attribute, leaving the prescribed ones alone
+		/// </summary>
+		void ClearAuxiliaryAttributes();
+
+		/// <summary>
+		/// returns a prescribed attribute by its slot, straight out of the order with no hashing
+		/// slots come from the signature order, so a child type's signatures must list its parent's first
+		/// </summary>
+		/// <param name="slot">the slot of the attribute, see TypeManager::SlotOf</param>
+		/// <returns>the datum in that slot</returns>
+		Datum& GetPrescribed(size_t slot);
+
+		/// <summary>
+		/// const version of GetPrescribed
+		/// </summary>
+		/// <param name="slot">the slot of the attribute, see TypeManager::SlotOf</param>
+		/// <returns>the datum in that slot</returns>
+		const Datum& GetPrescribed(size_t slot) const;
+
+		/// <summary>
+		/// returns a prescribed attribute by a slot known at compile time
+		/// </summary>
+		/// <typeparam name="Slot">the slot of the attribute</typeparam>
+		/// <returns>the datum in that slot</returns>
+		template<size_t Slot>
+		Datum& GetPrescribed();
+
+		/// <summary>
+		/// const version of GetPrescribed
+		/// </summary>
+		/// <typeparam name="Slot">the slot of the attribute</typeparam>
+		/// <returns>the datum in that slot</returns>
+		template<size_t Slot>
+		const Datum& GetPrescribed() const;
+
+		/// <summary>
+		/// returns the row that holds this instance's prescribed attributes, for finding it in TypeManager::Columns
+		/// </summary>
+		/// <returns>the row, only meaningful if the type is stored in columns</returns>
+		size_t Row() const;
+
+		/// <summary>
+		/// the slot of the this attribute, which every attributed appends first
+		/// </summary>
+		static constexpr size_t s_ThisSlot = 0;
+
 	protected:
 		/// <summary>
 		/// constructor for attributed 
@@ -118,5 +176,65 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="other">the attributed to get the signatures of to update with</param>
 		void UpdatePointers(const Attributed& other);
+
+		/// <summary>
+		/// returns where a prescribed attribute's values are stored
+		/// </summary>
+		/// <param name="signature">the signature of the attribute</param>
+		/// <returns>its values in the row if the type is stored in columns, otherwise the member at the signature's offset</returns>
+		void* StorageOf(const Signature& signature);
+
+		/// <summary>
+		/// helper function for copy semantics
+		/// makes sure this has a row in the same columns as other, then copies other's row into it
+		/// </summary>
+		/// <param name="other">the attributed being copied</param>
+		void CopyRow(const Attributed& other);
+
+		/// <summary>
+		/// helper function for move semantics
+		/// gives back this row and takes other's, leaving other without one
+		/// </summary>
+		/// <param name="other">the attributed being moved</param>
+		void TakeRow(Attributed& other);
+
+		/// <summary>
+		/// gives back this row, if it has one
+		/// </summary>
+		void ReleaseRow();
+
+		/// <summary>
+		/// the columns this row is in, nullptr if the type is stored in its members
+		/// </summary>
+		ColumnStore* m_Columns = nullptr;
+
+		/// <summary>
+		/// this instance's row in m_Columns
+		/// </summary>
+		size_t m_Row = 0;
 	};
+
+	inline Datum& Attributed::GetPrescribed(size_t slot)
+	{
+		assert(slot < m_Order.Size());
+		return m_Order[slot]->second;
+	}
+
+	inline const Datum& Attributed::GetPrescribed(size_t slot) const
+	{
+		assert(slot < m_Order.Size());
+		return m_Order[slot]->second;
+	}
+
+	template<size_t Slot>
+	inline Datum& Attributed::GetPrescribed()
+	{
+		return GetPrescribed(Slot);
+	}
+
+	template<size_t Slot>
+	inline const Datum& Attributed::GetPrescribed() const
+	{
+		return GetPrescribed(Slot);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,1111 @@
+#include "pch.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "Vector.h"
+#include "SList.h"
+#include "HashMap.h"
+#include "Datum.h"
+#include "Scope.h"
+#include "ActionCreateAction.h"
+#include "ActionDestroyAction.h"
+#include "ActionEvent.h"
+#include "ActionIf.h"
+#include "ActionIncrement.h"
+#include "ActionList.h"
+#include "Entity.h"
+#include "EventMessageAttributed.h"
+#include "ReactionAttributed.h"
+#include "Sector.h"
+#include "World.h"
+#include "SlabAllocator.h"
+#include "Event.h"
+#include "EventPool.h"
+#include "EventQueue.h"
+#include "GlmText.h"
+#include <mutex>
+
+using namespace FieaGameEngine;
+
+namespace
+{
+	/// <summary>
+	/// the number of times the global operator new has been called, for benchmarks that count heap allocations
+	/// </summary>
+	std::atomic<size_t> s_HeapAllocations{ 0 };
+}
+
+//counts every trip to the heap, so a benchmark can report the allocations it made per item
+void* operator new(size_t size)
+{
+	s_HeapAllocations.fetch_add(1, std::memory_order_relaxed);
+
+	void* block = malloc((size == 0) ? 1 : size);
+	if (block == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return block;
+}
+
+void operator delete(void* block) noexcept
+{
+	free(block);
+}
+
+void operator delete(void* block, size_t) noexcept
+{
+	free(block);
+}
+
+namespace
+{
+	/// <summary>
+	/// the smallest and largest container sizes to run at, ten times apart each step
+	/// </summary>
+	constexpr int64_t s_MinSize = 10;
+	constexpr int64_t s_MaxSize = 1000000;
+
+	/// <summary>
+	/// makes a string key that is too long for the small string buffer, like most names in a scope
+	/// </summary>
+	/// <param name="index">the number in the key</param>
+	/// <returns>the key</returns>
+	std::string MakeKey(int64_t index)
+	{
+		return "benchmark_key_" + std::to_string(index);
+	}
+
+	/// <summary>
+	/// builds a tree of scopes, each with a few attributes of every type and breadth nested scopes
+	/// </summary>
+	/// <param name="scope">the scope to fill</param>
+	/// <param name="depth">the number of levels to go below scope</param>
+	/// <param name="breadth">the number of nested scopes in each scope</param>
+	void BuildTree(Scope& scope, int64_t depth, int64_t breadth)
+	{
+		scope.Append("Health") = 100;
+		scope.Append("Speed") = 2.5f;
+		scope.Append("Name") = std::string("a name long enough to be on the heap");
+		scope.Append("Position") = glm::vec4(1.0f, 2.0f, 3.0f, 1.0f);
+		scope.Append("Transform") = glm::mat4(1.0f);
+
+		if (depth > 0)
+		{
+			for (int64_t i = 0; i < breadth; ++i)
+			{
+				BuildTree(scope.AppendScope("Child" + std::to_string(i)), depth - 1, breadth);
+			}
+		}
+	}
+
+	/// <summary>
+	/// returns the deepest scope down the first child of every level
+	/// </summary>
+	/// <param name="scope">the scope to start from</param>
+	/// <returns>the deepest scope</returns>
+	Scope& Deepest(Scope& scope)
+	{
+		Datum* child = scope.Find("Child0");
+		return (child == nullptr) ? scope : Deepest(child->Get<Scope>());
+	}
+
+	/// <summary>
+	/// a value of each datum type to push and set
+	/// </summary>
+	template<typename T>
+	T MakeValue();
+
+	template<>
+	int MakeValue<int>()
+	{
+		return 7;
+	}
+
+	template<>
+	float MakeValue<float>()
+	{
+		return 7.0f;
+	}
+
+	template<>
+	std::string MakeValue<std::string>()
+	{
+		return "a value long enough to be on the heap";
+	}
+
+	template<>
+	glm::vec4 MakeValue<glm::vec4>()
+	{
+		return glm::vec4(1.0f, 2.0f, 3.0f, 4.0f);
+	}
+
+	template<>
+	glm::mat4 MakeValue<glm::mat4>()
+	{
+		return glm::mat4(1.0f);
+	}
+
+	template<>
+	RTTI* MakeValue<RTTI*>()
+	{
+		static Scope s_Target;
+		return &s_Target;
+	}
+}
+
+#pragma region Vector
+static void VectorPushBack(benchmark::State& state)
+{
+	for (auto _ : state)
+	{
+		Vector<int> vector;
+		for (int64_t i = 0; i < state.range(0); ++i)
+		{
+			vector.PushBack(static_cast<int>(i));
+		}
+		benchmark::DoNotOptimize(vector.Size());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(VectorPushBack)->RangeMultiplier(10)->Range(s_MinSize, s_MaxSize);
+
+static void VectorFind(benchmark::State& state)
+{
+	Vector<int> vector;
+	for (int64_t i = 0; i < state.range(0); ++i)
+	{
+		vector.PushBack(static_cast<int>(i));
+	}
+
+	//the last value, so every find walks the whole vector
+	int toFind = static_cast<int>(state.range(0) - 1);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(vector.Find(toFind));
+	}
+}
+BENCHMARK(VectorFind)->RangeMultiplier(10)->Range(s_MinSize, s_MaxSize);
+
+static void VectorRemove(benchmark::State& state)
+{
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		Vector<int> vector;
+		for (int64_t i = 0; i < state.range(0); ++i)
+		{
+			vector.PushBack(static_cast<int>(i));
+		}
+		state.ResumeTiming();
+
+		//from the front, so every remove shifts the rest of the vector
+		for (int64_t i = 0; i < state.range(0); ++i)
+		{
+			vector.Remove(static_cast<int>(i));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(VectorRemove)->RangeMultiplier(10)->Range(s_MinSize, 10000);
+
+/// <summary>
+/// an element with user written copies, moves and destructor, so it isn't trivially copyable
+/// Moved relocates by moving every element, Relocated is the same type with IsTriviallyRelocatable specialized, so it reallocs
+/// </summary>
+template<bool Relocatable>
+struct GrowthElement final
+{
+	GrowthElement(int64_t value) : m_Value(value) {}
+	GrowthElement(const GrowthElement& other) : m_Value(other.m_Value) {}
+	GrowthElement(GrowthElement&& other) noexcept : m_Value(other.m_Value) {}
+	GrowthElement& operator=(const GrowthElement&) = delete;
+	GrowthElement& operator=(GrowthElement&&) = delete;
+	~GrowthElement() { benchmark::DoNotOptimize(m_Value); }
+
+	int64_t m_Value;
+	std::uint8_t m_Padding[56];
+};
+using MovedElement = GrowthElement<false>;
+using RelocatedElement = GrowthElement<true>;
+
+namespace FieaGameEngine
+{
+	template<>
+	struct IsTriviallyRelocatable<RelocatedElement> : std::true_type {};
+}
+
+namespace
+{
+	template<typename T>
+	T MakeGrowthValue(int64_t index)
+	{
+		return T(index);
+	}
+
+	template<>
+	std::string MakeGrowthValue<std::string>(int64_t index)
+	{
+		return MakeKey(index);
+	}
+}
+
+/// <summary>
+/// pushes size elements onto an empty vector, so the cost of every grow and relocation is amortized over the pushes
+/// </summary>
+template<typename T>
+static void VectorGrowth(benchmark::State& state)
+{
+	for (auto _ : state)
+	{
+		Vector<T> vector;
+		for (int64_t i = 0; i < state.range(0); ++i)
+		{
+			vector.EmplaceBack(MakeGrowthValue<T>(i));
+		}
+		benchmark::DoNotOptimize(vector.Size());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(VectorGrowth, int)->RangeMultiplier(10)->Range(s_MinSize, s_MaxSize);
+BENCHMARK_TEMPLATE(VectorGrowth, std::string)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(VectorGrowth, MovedElement)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(VectorGrowth, RelocatedElement)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+
+/// <summary>
+/// the same pushes onto a std::vector, for comparison
+/// </summary>
+template<typename T>
+static void StdVectorGrowth(benchmark::State& state)
+{
+	for (auto _ : state)
+	{
+		std::vector<T> vector;
+		for (int64_t i = 0; i < state.range(0); ++i)
+		{
+			vector.emplace_back(MakeGrowthValue<T>(i));
+		}
+		benchmark::DoNotOptimize(vector.size());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(StdVectorGrowth, int)->RangeMultiplier(10)->Range(s_MinSize, s_MaxSize);
+BENCHMARK_TEMPLATE(StdVectorGrowth, std::string)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(StdVectorGrowth, MovedElement)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+#pragma endregion
+
+#pragma region SList
+static void SListPushBack(benchmark::State& state)
+{
+	for (auto _ : state)
+	{
+		SList<int> list;
+		for (int64_t i = 0; i < state.range(0); ++i)
+		{
+			list.PushBack(static_cast<int>(i));
+		}
+		benchmark::DoNotOptimize(list.Size());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(SListPushBack)->RangeMultiplier(10)->Range(s_MinSize, s_MaxSize);
+
+static void SListPushFront(benchmark::State& state)
+{
+	for (auto _ : state)
+	{
+		SList<int> list;
+		for (int64_t i = 0; i < state.range(0); ++i)
+		{
+			list.PushFront(static_cast<int>(i));
+		}
+		benchmark::DoNotOptimize(list.Size());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(SListPushFront)->RangeMultiplier(10)->Range(s_MinSize, s_MaxSize);
+
+static void SListPopFront(benchmark::State& state)
+{
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		SList<int> list;
+		for (int64_t i = 0; i < state.range(0); ++i)
+		{
+			list.PushBack(static_cast<int>(i));
+		}
+		state.ResumeTiming();
+
+		while (!list.IsEmpty())
+		{
+			list.PopFront();
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(SListPopFront)->RangeMultiplier(10)->Range(s_MinSize, s_MaxSize);
+
+static void SListPopBack(benchmark::State& state)
+{
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		SList<int> list;
+		for (int64_t i = 0; i < state.range(0); ++i)
+		{
+			list.PushBack(static_cast<int>(i));
+		}
+		state.ResumeTiming();
+
+		//every pop walks to the new back, so this stops short of a million
+		while (!list.IsEmpty())
+		{
+			list.PopBack();
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(SListPopBack)->RangeMultiplier(10)->Range(s_MinSize, 10000);
+#pragma endregion
+
+#pragma region HashMap
+template<typename TKey>
+TKey MakeMapKey(int64_t index);
+
+template<>
+int MakeMapKey<int>(int64_t index)
+{
+	return static_cast<int>(index);
+}
+
+template<>
+std::string MakeMapKey<std::string>(int64_t index)
+{
+	return MakeKey(index);
+}
+
+template<typename TKey>
+static void HashMapInsert(benchmark::State& state)
+{
+	Vector<TKey> keys(static_cast<size_t>(state.range(0)));
+	for (int64_t i = 0; i < state.range(0); ++i)
+	{
+		keys.PushBack(MakeMapKey<TKey>(i));
+	}
+
+	for (auto _ : state)
+	{
+		HashMap<TKey, int> map(static_cast<size_t>(state.range(0)));
+		for (const TKey& key : keys)
+		{
+			map.Insert(std::make_pair(key, 0));
+		}
+		benchmark::DoNotOptimize(map.Size());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(HashMapInsert, int)->RangeMultiplier(10)->Range(s_MinSize, s_MaxSize);
+BENCHMARK_TEMPLATE(HashMapInsert, std::string)->RangeMultiplier(10)->Range(s_MinSize, s_MaxSize);
+
+template<typename TKey>
+static void HashMapFind(benchmark::State& state)
+{
+	Vector<TKey> keys(static_cast<size_t>(state.range(0)));
+	HashMap<TKey, int> map(static_cast<size_t>(state.range(0)));
+	for (int64_t i = 0; i < state.range(0); ++i)
+	{
+		keys.PushBack(MakeMapKey<TKey>(i));
+		map.Insert(std::make_pair(keys.Back(), 0));
+	}
+
+	for (auto _ : state)
+	{
+		for (const TKey& key : keys)
+		{
+			benchmark::DoNotOptimize(map.Find(key));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(HashMapFind, int)->RangeMultiplier(10)->Range(s_MinSize, s_MaxSize);
+BENCHMARK_TEMPLATE(HashMapFind, std::string)->RangeMultiplier(10)->Range(s_MinSize, s_MaxSize);
+#pragma endregion
+
+#pragma region Hash
+namespace
+{
+	/// <summary>
+	/// the keys real scopes are filled with, picked by the benchmark's first argument
+	/// 0 is every prescribed attribute name in the engine, 1 is the names nested scopes get when they are appended in a loop,
+	/// and 2 is every ordering of the letters in a short attribute name, which the additive hash can't tell apart
+	/// </summary>
+	/// <param name="set">which key set</param>
+	/// <returns>the keys, without repeats</returns>
+	Vector<std::string> MakeKeySet(int64_t set)
+	{
+		Vector<std::string> keys;
+
+		if (set == 0)
+		{
+			keys.PushBack("this");
+			for (const Vector<Signature>& signatures : { ActionCreateAction::Signatures(), ActionDestroyAction::Signatures(), ActionEvent::Signatures(),
+				ActionIf::Signatures(), ActionIncrement::Signatures(), ActionList::Signatures(), Entity::Signatures(), EventMessageAttributed::Signatures(),
+				ReactionAttributed::Signatures(), Sector::Signatures(), World::Signatures() })
+			{
+				for (const Signature& signature : signatures)
+				{
+					if (keys.Find(signature.m_Name) == keys.end())
+					{
+						keys.PushBack(signature.m_Name);
+					}
+				}
+			}
+		}
+		else if (set == 1)
+		{
+			for (int i = 0; i < 10000; ++i)
+			{
+				keys.PushBack("Child" + std::to_string(i));
+			}
+		}
+		else
+		{
+			std::string name = "m_Delay";
+			std::sort(name.begin(), name.end());
+			do
+			{
+				keys.PushBack(name);
+			} while (std::next_permutation(name.begin(), name.end()));
+		}
+
+		return keys;
+	}
+}
+
+/// <summary>
+/// hashes a key set into as many buckets as it has keys, the way HashMap picks a bucket, and reports how evenly they land
+/// collisions is the number of keys that landed in a bucket someone already had, expected is that number for a perfectly random hash,
+/// longest is the most keys in one bucket and identical is the number of keys whose whole hash matched an earlier key's
+/// </summary>
+template<typename HashPolicy>
+static void HashDistribution(benchmark::State& state)
+{
+	Vector<std::string> keys = MakeKeySet(state.range(0));
+	DefaultHash<std::string, HashPolicy> hash;
+
+	Vector<size_t> hashes(keys.Size());
+	for (auto _ : state)
+	{
+		hashes.Clear();
+		for (const std::string& key : keys)
+		{
+			hashes.PushBack(hash(key));
+		}
+		benchmark::DoNotOptimize(hashes.Back());
+	}
+	state.SetItemsProcessed(state.iterations() * keys.Size());
+
+	size_t bucketCount = keys.Size();
+	Vector<size_t> buckets(bucketCount);
+	for (size_t i = 0; i < bucketCount; ++i)
+	{
+		buckets.PushBack(0);
+	}
+
+	size_t collisions = 0;
+	size_t longest = 0;
+	for (size_t value : hashes)
+	{
+		size_t& bucket = buckets[value % bucketCount];
+		collisions += (bucket > 0) ? 1 : 0;
+		longest = std::max(longest, ++bucket);
+	}
+
+	std::sort(&hashes.Front(), &hashes.Front() + hashes.Size());
+	size_t identical = 0;
+	for (size_t i = 1; i < hashes.Size(); ++i)
+	{
+		identical += (hashes[i] == hashes[i - 1]) ? 1 : 0;
+	}
+
+	double count = static_cast<double>(bucketCount);
+	state.counters["keys"] = count;
+	state.counters["collisions"] = static_cast<double>(collisions);
+	state.counters["expected"] = count - (count * (1.0 - std::pow(1.0 - (1.0 / count), count)));
+	state.counters["longest"] = static_cast<double>(longest);
+	state.counters["identical"] = static_cast<double>(identical);
+}
+BENCHMARK_TEMPLATE(HashDistribution, AdditiveHashPolicy)->DenseRange(0, 2);
+BENCHMARK_TEMPLATE(HashDistribution, FastHashPolicy)->DenseRange(0, 2);
+
+template<typename HashPolicy>
+static void HashThroughput(benchmark::State& state)
+{
+	Vector<std::uint8_t> bytes(static_cast<size_t>(state.range(0)));
+	for (int64_t i = 0; i < state.range(0); ++i)
+	{
+		bytes.PushBack(static_cast<std::uint8_t>(i * 31));
+	}
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(HashPolicy::Hash(&bytes.Front(), bytes.Size()));
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(HashThroughput, AdditiveHashPolicy)->RangeMultiplier(4)->Range(4, 4096);
+BENCHMARK_TEMPLATE(HashThroughput, FastHashPolicy)->RangeMultiplier(4)->Range(4, 4096);
+
+/// <summary>
+/// finds every key of a key set in a map using the given hash, so the cost of collisions shows up next to the cost of hashing
+/// </summary>
+template<typename HashPolicy>
+static void HashMapFindKeySet(benchmark::State& state)
+{
+	Vector<std::string> keys = MakeKeySet(state.range(0));
+	HashMap<std::string, int, DefaultHash<std::string, HashPolicy>> map(keys.Size());
+	for (const std::string& key : keys)
+	{
+		map.Insert(std::make_pair(key, 0));
+	}
+
+	for (auto _ : state)
+	{
+		for (const std::string& key : keys)
+		{
+			benchmark::DoNotOptimize(map.Find(key));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * keys.Size());
+}
+BENCHMARK_TEMPLATE(HashMapFindKeySet, AdditiveHashPolicy)->DenseRange(0, 2);
+BENCHMARK_TEMPLATE(HashMapFindKeySet, FastHashPolicy)->DenseRange(0, 2);
+#pragma endregion
+
+#pragma region Datum
+template<typename T>
+static void DatumPushBack(benchmark::State& state)
+{
+	const T value = MakeValue<T>();
+	for (auto _ : state)
+	{
+		Datum datum;
+		for (int64_t i = 0; i < state.range(0); ++i)
+		{
+			datum.PushBack(value);
+		}
+		benchmark::DoNotOptimize(datum.Size());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(DatumPushBack, int)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(DatumPushBack, float)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(DatumPushBack, std::string)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(DatumPushBack, glm::vec4)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(DatumPushBack, glm::mat4)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(DatumPushBack, RTTI*)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+
+template<typename T>
+static void DatumGet(benchmark::State& state)
+{
+	Datum datum;
+	for (int64_t i = 0; i < state.range(0); ++i)
+	{
+		datum.PushBack(MakeValue<T>());
+	}
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < datum.Size(); ++i)
+		{
+			benchmark::DoNotOptimize(datum.Get<T>(i));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(DatumGet, int)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(DatumGet, float)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(DatumGet, std::string)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(DatumGet, glm::vec4)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(DatumGet, glm::mat4)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(DatumGet, RTTI*)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+
+template<typename T>
+static void DatumSet(benchmark::State& state)
+{
+	Datum datum;
+	for (int64_t i = 0; i < state.range(0); ++i)
+	{
+		datum.PushBack(MakeValue<T>());
+	}
+
+	T value = MakeValue<T>();
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < datum.Size(); ++i)
+		{
+			datum.Set(value, i);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(DatumSet, int)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(DatumSet, float)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(DatumSet, std::string)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(DatumSet, glm::vec4)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(DatumSet, glm::mat4)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+BENCHMARK_TEMPLATE(DatumSet, RTTI*)->RangeMultiplier(10)->Range(s_MinSize, 100000);
+
+static void DatumAppendScope(benchmark::State& state)
+{
+	for (auto _ : state)
+	{
+		Scope scope;
+		for (int64_t i = 0; i < state.range(0); ++i)
+		{
+			scope.AppendScope("Table");
+		}
+		benchmark::DoNotOptimize(scope.Find("Table")->Size());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(DatumAppendScope)->RangeMultiplier(10)->Range(s_MinSize, 10000);
+#pragma endregion
+
+#pragma region GlmText
+namespace
+{
+	/// <summary>
+	/// the number of vectors and matrices each parse benchmark cycles through, so the digits vary from one to the next
+	/// </summary>
+	constexpr size_t s_GlmTextCount = 256;
+
+	/// <summary>
+	/// returns the text forms of vectors or matrices with a mix of whole, fractional, negative and exponent-sized floats
+	/// </summary>
+	template<typename T>
+	const Vector<std::string>& GlmTexts()
+	{
+		static const Vector<std::string> s_Texts = []()
+		{
+			Vector<std::string> texts(s_GlmTextCount);
+			for (size_t i = 0; i < s_GlmTextCount; ++i)
+			{
+				T value;
+				float* floats = reinterpret_cast<float*>(&value);
+				for (size_t f = 0; f < sizeof(T) / sizeof(float); ++f)
+				{
+					floats[f] = static_cast<float>(std::pow(-1.7, static_cast<double>((i + f) % 23)) * static_cast<double>(i + 1) / 3.0);
+				}
+				texts.PushBack(GlmText::ToString(value));
+			}
+			return texts;
+		}();
+		return s_Texts;
+	}
+
+	/// <summary>
+	/// how the vector and matrix attributes were read before GlmText, for comparison
+	/// </summary>
+	glm::vec4 ScanVector(const std::string& text)
+	{
+		glm::vec4 vector;
+		std::sscanf(text.c_str(), "vec4(%f, %f, %f, %f)", &vector[0], &vector[1], &vector[2], &vector[3]);
+		return vector;
+	}
+
+	glm::mat4 ScanMatrix(const std::string& text)
+	{
+		glm::mat4 matrix;
+		std::sscanf(text.c_str(), "mat4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))",
+			&matrix[0][0], &matrix[0][1], &matrix[0][2], &matrix[0][3], &matrix[1][0], &matrix[1][1], &matrix[1][2], &matrix[1][3],
+			&matrix[2][0], &matrix[2][1], &matrix[2][2], &matrix[2][3], &matrix[3][0], &matrix[3][1], &matrix[3][2], &matrix[3][3]);
+		return matrix;
+	}
+
+	glm::vec4 ParseText(const std::string& text, const glm::vec4&)
+	{
+		return GlmText::ParseVector(text);
+	}
+
+	glm::mat4 ParseText(const std::string& text, const glm::mat4&)
+	{
+		return GlmText::ParseMatrix(text);
+	}
+
+	glm::vec4 ScanText(const std::string& text, const glm::vec4&)
+	{
+		return ScanVector(text);
+	}
+
+	glm::mat4 ScanText(const std::string& text, const glm::mat4&)
+	{
+		return ScanMatrix(text);
+	}
+}
+
+/// <summary>
+/// reads vector or matrix text through GlmText, which uses from_chars
+/// items are floats, so vectors and matrices can be compared
+/// </summary>
+template<typename T>
+static void GlmTextParse(benchmark::State& state)
+{
+	const Vector<std::string>& texts = GlmTexts<T>();
+	size_t index = 0;
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(ParseText(texts[index], T()));
+		index = (index + 1) % s_GlmTextCount;
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(sizeof(T) / sizeof(float)));
+}
+BENCHMARK_TEMPLATE(GlmTextParse, glm::vec4);
+BENCHMARK_TEMPLATE(GlmTextParse, glm::mat4);
+
+/// <summary>
+/// the same text through the sscanf format strings the datum used to read it with
+/// </summary>
+template<typename T>
+static void GlmTextScan(benchmark::State& state)
+{
+	const Vector<std::string>& texts = GlmTexts<T>();
+	size_t index = 0;
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(ScanText(texts[index], T()));
+		index = (index + 1) % s_GlmTextCount;
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(sizeof(T) / sizeof(float)));
+}
+BENCHMARK_TEMPLATE(GlmTextScan, glm::vec4);
+BENCHMARK_TEMPLATE(GlmTextScan, glm::mat4);
+#pragma endregion
+
+#pragma region Scope
+static void ScopeAppend(benchmark::State& state)
+{
+	Vector<std::string> keys(static_cast<size_t>(state.range(0)));
+	for (int64_t i = 0; i < state.range(0); ++i)
+	{
+		keys.PushBack(MakeKey(i));
+	}
+
+	for (auto _ : state)
+	{
+		Scope scope;
+		for (const std::string& key : keys)
+		{
+			scope.Append(key);
+		}
+		benchmark::DoNotOptimize(scope.Size());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(ScopeAppend)->RangeMultiplier(10)->Range(s_MinSize, 10000);
+
+static void ScopeFind(benchmark::State& state)
+{
+	Vector<std::string> keys(static_cast<size_t>(state.range(0)));
+	Scope scope;
+	for (int64_t i = 0; i < state.range(0); ++i)
+	{
+		keys.PushBack(MakeKey(i));
+		scope.Append(keys.Back());
+	}
+
+	for (auto _ : state)
+	{
+		for (const std::string& key : keys)
+		{
+			benchmark::DoNotOptimize(scope.Find(key));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(ScopeFind)->RangeMultiplier(10)->Range(s_MinSize, 10000);
+
+//the tree benchmarks take the depth, with four nested scopes in each scope
+/// <summary>
+/// looks up attribute names by string from several threads at once, the way parallel updates and parses do
+/// </summary>
+static void ScopeFindStringThreaded(benchmark::State& state)
+{
+	static Scope& s_Root = []() -> Scope&
+	{
+		static Scope root;
+		BuildTree(root, 0, 0);
+		return root;
+	}();
+
+	const std::string health = "Health";
+	const std::string missing = "NotAnAttribute";
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(s_Root.Find(health));
+		benchmark::DoNotOptimize(s_Root.Find(missing));
+	}
+	state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(ScopeFindStringThreaded)->ThreadRange(1, 8);
+
+static void ScopeSearch(benchmark::State& state)
+{
+	Scope root;
+	BuildTree(root, state.range(0), 4);
+	root.Append("RootOnly") = 1;
+	Scope& leaf = Deepest(root);
+
+	//found at the leaf, then found at the root after walking up every level
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(leaf.Search("Health"));
+		benchmark::DoNotOptimize(leaf.Search("RootOnly"));
+	}
+}
+BENCHMARK(ScopeSearch)->DenseRange(1, 7, 2);
+
+static void ScopeClone(benchmark::State& state)
+{
+	Scope root;
+	BuildTree(root, state.range(0), 4);
+
+	for (auto _ : state)
+	{
+		Scope* clone = root.Clone();
+		benchmark::DoNotOptimize(clone);
+		delete clone;
+	}
+}
+BENCHMARK(ScopeClone)->DenseRange(1, 7, 2);
+#pragma endregion
+
+#pragma region EventQueue
+namespace
+{
+	/// <summary>
+	/// the number of events each producer thread enqueues per run, fixed so the queue doesn't grow with the run time
+	/// </summary>
+	constexpr int64_t s_EnqueuesPerThread = 100000;
+
+	/// <summary>
+	/// the queue every producer thread enqueues into, and the time it reads
+	/// </summary>
+	GameTime& ProducerTime()
+	{
+		static GameTime s_Time;
+		return s_Time;
+	}
+
+	EventQueue& ProducerQueue()
+	{
+		static EventQueue s_Queue(ProducerTime());
+		return s_Queue;
+	}
+
+	/// <summary>
+	/// what Enqueue would cost with the pending events in one Vector behind a mutex, the way the old Enqueue would have
+	/// needed to be to take events from more than one thread
+	/// </summary>
+	struct LockedQueue final
+	{
+		struct Entry final
+		{
+			std::shared_ptr<EventPublisher> m_Event;
+			std::chrono::high_resolution_clock::time_point m_Expiry;
+			size_t m_OrderKey;
+			size_t m_Sequence;
+		};
+
+		void Enqueue(std::shared_ptr<EventPublisher> publisher, std::chrono::milliseconds delay)
+		{
+			std::chrono::high_resolution_clock::time_point expiry = ProducerTime().CurrentTime() + delay;
+
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Entries.PushBack(Entry{ std::move(publisher), expiry, 0, m_NextSequence++ });
+		}
+
+		std::mutex m_Mutex;
+		Vector<Entry> m_Entries;
+		size_t m_NextSequence = 0;
+	};
+
+	LockedQueue& LockedProducerQueue()
+	{
+		static LockedQueue s_Queue;
+		return s_Queue;
+	}
+}
+
+/// <summary>
+/// every thread enqueues into the same queue through the lock-free staging stack
+/// each thread enqueues its own event over and over, so the only thing the threads share is the queue
+/// </summary>
+static void EventQueueEnqueueContended(benchmark::State& state)
+{
+	EventQueue& queue = ProducerQueue();
+	std::shared_ptr<EventPublisher> event = std::make_shared<Event<int>>(state.thread_index());
+
+	for (auto _ : state)
+	{
+		queue.Enqueue(event);
+	}
+
+	if (state.thread_index() == 0)
+	{
+		queue.Clear();
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(EventQueueEnqueueContended)->Iterations(s_EnqueuesPerThread)->ThreadRange(1, 8)->UseRealTime();
+
+/// <summary>
+/// the same enqueues into a mutex guarded vector, for comparison
+/// </summary>
+static void LockedQueueEnqueueContended(benchmark::State& state)
+{
+	LockedQueue& queue = LockedProducerQueue();
+	std::shared_ptr<EventPublisher> event = std::make_shared<Event<int>>(state.thread_index());
+
+	for (auto _ : state)
+	{
+		queue.Enqueue(event, std::chrono::milliseconds(0));
+	}
+
+	if (state.thread_index() == 0)
+	{
+		queue.m_Entries.Clear();
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(LockedQueueEnqueueContended)->Iterations(s_EnqueuesPerThread)->ThreadRange(1, 8)->UseRealTime();
+
+/// <summary>
+/// fires events the way gameplay code does, making each one, queueing it, and letting Update deliver and release it
+/// the events come from std::make_shared, so every one is a trip to the heap for the event and its control block
+/// the argument is the number of events fired between updates, heap_allocs is the number of trips to the heap per event
+/// </summary>
+static void EventFireMakeShared(benchmark::State& state)
+{
+	GameTime time;
+	EventQueue queue(time);
+	const int64_t batch = state.range(0);
+
+	size_t before = s_HeapAllocations.load(std::memory_order_relaxed);
+	for (auto _ : state)
+	{
+		for (int64_t i = 0; i < batch; ++i)
+		{
+			queue.Enqueue(std::make_shared<Event<int>>(static_cast<int>(i)));
+		}
+		queue.Update();
+	}
+	size_t allocations = s_HeapAllocations.load(std::memory_order_relaxed) - before;
+
+	state.SetItemsProcessed(state.iterations() * batch);
+	state.counters["heap_allocs"] = static_cast<double>(allocations) / static_cast<double>(state.iterations() * batch);
+}
+BENCHMARK(EventFireMakeShared)->RangeMultiplier(8)->Range(1, 512);
+
+/// <summary>
+/// the same events from EventPool, which hands the released ones back out, for comparison
+/// </summary>
+static void EventFirePooled(benchmark::State& state)
+{
+	GameTime time;
+	EventQueue queue(time);
+	const int64_t batch = state.range(0);
+
+	size_t before = s_HeapAllocations.load(std::memory_order_relaxed);
+	for (auto _ : state)
+	{
+		for (int64_t i = 0; i < batch; ++i)
+		{
+			queue.Enqueue(EventPool<int>::Acquire(static_cast<int>(i)));
+		}
+		queue.Update();
+	}
+	size_t allocations = s_HeapAllocations.load(std::memory_order_relaxed) - before;
+
+	state.SetItemsProcessed(state.iterations() * batch);
+	state.counters["heap_allocs"] = static_cast<double>(allocations) / static_cast<double>(state.iterations() * batch);
+	EventPool<int>::Trim();
+}
+BENCHMARK(EventFirePooled)->RangeMultiplier(8)->Range(1, 512);
+#pragma endregion
+
+#pragma region Allocator
+/// <summary>
+/// allocates and frees count blocks the size of a scope, from the slab allocator when the second argument is 1
+/// and from plain new and delete otherwise, which is how every scope was allocated before the slab allocator
+/// heap_allocs is the number of trips to the heap per block
+/// </summary>
+static void ScopeBlockAllocate(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	const bool slab = (state.range(1) == 1);
+	Vector<void*> blocks(count);
+
+	size_t before = s_HeapAllocations.load(std::memory_order_relaxed);
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			blocks.PushBack(slab ? SlabAllocator::Instance().Allocate(sizeof(Scope)) : ::operator new(sizeof(Scope)));
+		}
+
+		for (void* block : blocks)
+		{
+			if (slab)
+			{
+				SlabAllocator::Instance().Deallocate(block, sizeof(Scope));
+			}
+			else
+			{
+				::operator delete(block);
+			}
+		}
+		blocks.Clear();
+	}
+	size_t allocations = s_HeapAllocations.load(std::memory_order_relaxed) - before;
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.counters["heap_allocs"] = static_cast<double>(allocations) / static_cast<double>(state.iterations() * state.range(0));
+}
+BENCHMARK(ScopeBlockAllocate)->ArgsProduct({ { 100, 10000 }, { 0, 1 } });
+
+/// <summary>
+/// builds and destroys a tree of scopes, and reports the trips to the heap per scope
+/// the scopes themselves come from the slab allocator, so what is left is their tables, orders and datum buffers
+/// </summary>
+static void ScopeTreeAllocations(benchmark::State& state)
+{
+	size_t scopes = 0;
+	size_t before = s_HeapAllocations.load(std::memory_order_relaxed);
+	for (auto _ : state)
+	{
+		Scope root;
+		BuildTree(root, state.range(0), 4);
+		scopes = 0;
+		for (int64_t level = 0, width = 1; level <= state.range(0); ++level, width *= 4)
+		{
+			scopes += static_cast<size_t>(width);
+		}
+	}
+	size_t allocations = s_HeapAllocations.load(std::memory_order_relaxed) - before;
+
+	state.SetItemsProcessed(state.iterations() * scopes);
+	state.counters["heap_allocs"] = static_cast<double>(allocations) / static_cast<double>(state.iterations() * scopes);
+	state.counters["slabs"] = static_cast<double>(SlabAllocator::Instance().SlabCount());
+}
+BENCHMARK(ScopeTreeAllocations)->DenseRange(1, 5, 2);
+#pragma endregion
+
+BENCHMARK_MAIN();
@@ -0,0 +1,14 @@
+#pragma once
+#include <cstddef>
+
+//forced into every file of the cmake build, to stand in for what the visual studio projects including the library define
+
+/// <summary>
+/// size_t literal, so 0_z is a size_t zero
+/// </summary>
+/// <param name="value">the literal</param>
+/// <returns>the literal as a size_t</returns>
+constexpr std::size_t operator""_z(unsigned long long value)
+{
+	return static_cast<std::size_t>(value);
+}
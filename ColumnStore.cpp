@@ -0,0 +1,218 @@
+#include "pch.h"
+#include "ColumnStore.h"
+
+namespace FieaGameEngine
+{
+	ColumnStore::ColumnStore(const Vector<Signature>& signatures)
+	{
+		//slot 0 is this, which is never stored in a column
+		m_Columns.Reserve(signatures.Size() + 1);
+		m_Columns.EmplaceBack();
+
+		for (const Signature& signature : signatures)
+		{
+			assert(m_Columns.Size() == signature.m_Slot);
+			Column& column = *m_Columns.EmplaceBack();
+
+			if (signature.m_Type != Datum::DatumTypes::TABLE && signature.m_Size > 0)
+			{
+				column.m_Type = signature.m_Type;
+				column.m_Width = signature.m_Size;
+				column.m_ElementSize = ElementSize(signature.m_Type);
+			}
+		}
+	}
+
+	ColumnStore::~ColumnStore()
+	{
+		for (Column& column : m_Columns)
+		{
+			for (std::uint8_t* chunk : column.m_Chunks)
+			{
+				if (column.m_Type == Datum::DatumTypes::STRING)
+				{
+					std::string* strings = reinterpret_cast<std::string*>(chunk);
+					for (size_t i = 0; i < (s_ChunkRows * column.m_Width); ++i)
+					{
+						strings[i].~basic_string();
+					}
+				}
+				free(chunk);
+			}
+		}
+	}
+
+	size_t ColumnStore::Acquire()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		size_t row;
+		if (!m_FreeRows.IsEmpty())
+		{
+			row = m_FreeRows.Back();
+			m_FreeRows.PopBack();
+			ResetRow(row);
+		}
+		else
+		{
+			row = m_RowCount++;
+			if (row == (m_ChunkCount * s_ChunkRows))
+			{
+				AddChunk();
+			}
+			m_Live.PushBack(false);
+		}
+
+		m_Live[row] = true;
+		return row;
+	}
+
+	void ColumnStore::Release(size_t row)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		assert(row < m_RowCount && m_Live[row]);
+		m_Live[row] = false;
+		m_FreeRows.PushBack(row);
+	}
+
+	void ColumnStore::CopyRow(size_t source, size_t destination)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		for (Column& column : m_Columns)
+		{
+			if (column.m_Type == Datum::DatumTypes::STRING)
+			{
+				const std::string* from = reinterpret_cast<const std::string*>(RowAt(column, source));
+				std::string* to = reinterpret_cast<std::string*>(RowAt(column, destination));
+				std::copy(from, from + column.m_Width, to);
+			}
+			else if (column.m_Type != Datum::DatumTypes::UNKNOWN)
+			{
+				memcpy(RowAt(column, destination), RowAt(column, source), column.m_Width * column.m_ElementSize);
+			}
+		}
+	}
+
+	bool ColumnStore::HasColumn(size_t slot) const
+	{
+		return (slot < m_Columns.Size() && m_Columns[slot].m_Type != Datum::DatumTypes::UNKNOWN);
+	}
+
+	void* ColumnStore::Data(size_t slot, size_t row)
+	{
+		//another thread adding a chunk can move the list of chunks
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return RowAt(ColumnAt(slot), row);
+	}
+
+	size_t ColumnStore::ChunkCount() const
+	{
+		return m_ChunkCount;
+	}
+
+	size_t ColumnStore::RowCount() const
+	{
+		return m_RowCount;
+	}
+
+	bool ColumnStore::IsLive(size_t row) const
+	{
+		return (row < m_RowCount && m_Live[row]);
+	}
+
+	size_t ColumnStore::LiveCount()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_RowCount - m_FreeRows.Size();
+	}
+
+	ColumnStore::Column& ColumnStore::ColumnAt(size_t slot)
+	{
+		if (!HasColumn(slot))
+		{
+			throw std::runtime_error("Attribute is not stored in a column");
+		}
+
+		return m_Columns[slot];
+	}
+
+	std::uint8_t* ColumnStore::RowAt(Column& column, size_t row)
+	{
+		std::uint8_t* chunk = column.m_Chunks[row / s_ChunkRows];
+		return chunk + ((row % s_ChunkRows) * column.m_Width * column.m_ElementSize);
+	}
+
+	void ColumnStore::AddChunk()
+	{
+		for (Column& column : m_Columns)
+		{
+			if (column.m_Type == Datum::DatumTypes::UNKNOWN)
+			{
+				continue;
+			}
+
+			size_t count = s_ChunkRows * column.m_Width;
+			std::uint8_t* chunk = static_cast<std::uint8_t*>(calloc(count, column.m_ElementSize));
+
+			if (chunk == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+
+			if (column.m_Type == Datum::DatumTypes::STRING)
+			{
+				std::string* strings = reinterpret_cast<std::string*>(chunk);
+				for (size_t i = 0; i < count; ++i)
+				{
+					new (strings + i) std::string();
+				}
+			}
+
+			column.m_Chunks.PushBack(chunk);
+		}
+
+		++m_ChunkCount;
+	}
+
+	void ColumnStore::ResetRow(size_t row)
+	{
+		for (Column& column : m_Columns)
+		{
+			if (column.m_Type == Datum::DatumTypes::STRING)
+			{
+				std::string* strings = reinterpret_cast<std::string*>(RowAt(column, row));
+				for (size_t i = 0; i < column.m_Width; ++i)
+				{
+					strings[i].clear();
+				}
+			}
+			else if (column.m_Type != Datum::DatumTypes::UNKNOWN)
+			{
+				memset(RowAt(column, row), 0, column.m_Width * column.m_ElementSize);
+			}
+		}
+	}
+
+	size_t ColumnStore::ElementSize(Datum::DatumTypes type)
+	{
+		switch (type)
+		{
+		case Datum::DatumTypes::INTEGER:
+			return sizeof(int);
+		case Datum::DatumTypes::FLOAT:
+			return sizeof(float);
+		case Datum::DatumTypes::STRING:
+			return sizeof(std::string);
+		case Datum::DatumTypes::VECTOR:
+			return sizeof(glm::vec4);
+		case Datum::DatumTypes::MATRIX:
+			return sizeof(glm::mat4);
+		case Datum::DatumTypes::POINTER:
+			return sizeof(RTTI*);
+		default:
+			return 0;
+		}
+	}
+}
@@ -0,0 +1,277 @@
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include "Signature.h"
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// ColumnStore class
+	/// structure of arrays storage for the prescribed attributes of one attributed type
+	/// every prescribed attribute that isn't a table gets its own column, and every instance of the type gets a row,
+	/// so one attribute of every instance sits next to each other in memory and can be walked in a straight line
+	/// columns grow a chunk of rows at a time and chunks never move, so the datums pointing into them stay valid
+	/// a released row goes back on a free list for the next instance, so rows can be dead while being walked, see IsLive
+	/// </summary>
+	class ColumnStore final
+	{
+	public:
+		/// <summary>
+		/// the number of rows in each chunk of a column
+		/// </summary>
+		static constexpr size_t s_ChunkRows = 256;
+
+		/// <summary>
+		/// constructor for the column store, makes an empty column for each signature
+		/// </summary>
+		/// <param name="signatures">the merged signatures of the type, in slot order</param>
+		explicit ColumnStore(const Vector<Signature>& signatures);
+
+		/// <summary>
+		/// deleted copy constructor
+		/// </summary>
+		ColumnStore(const ColumnStore&) = delete;
+
+		/// <summary>
+		/// deleted move constructor
+		/// </summary>
+		ColumnStore(ColumnStore&&) = delete;
+
+		/// <summary>
+		/// deleted copy assignment operator
+		/// </summary>
+		ColumnStore& operator=(const ColumnStore&) = delete;
+
+		/// <summary>
+		/// deleted move assignment operator
+		/// </summary>
+		ColumnStore& operator=(ColumnStore&&) = delete;
+
+		/// <summary>
+		/// destructor for the column store, frees every chunk
+		/// any instance still pointing into the columns is left dangling, see LiveCount
+		/// </summary>
+		~ColumnStore();
+
+		/// <summary>
+		/// hands out a row for a new instance, with every value zeroed and every string empty
+		/// safe to call from any number of threads at once
+		/// </summary>
+		/// <returns>the row</returns>
+		size_t Acquire();
+
+		/// <summary>
+		/// gives a row back so a later instance can reuse it
+		/// safe to call from any number of threads at once
+		/// </summary>
+		/// <param name="row">the row to give back</param>
+		void Release(size_t row);
+
+		/// <summary>
+		/// copies every value of one row into another
+		/// </summary>
+		/// <param name="source">the row to copy from</param>
+		/// <param name="destination">the row to copy to</param>
+		void CopyRow(size_t source, size_t destination);
+
+		/// <summary>
+		/// returns whether or not a slot has a column, tables and the this attribute don't
+		/// </summary>
+		/// <param name="slot">the slot of the attribute</param>
+		/// <returns>whether or not the slot has a column</returns>
+		bool HasColumn(size_t slot) const;
+
+		/// <summary>
+		/// returns the values of one attribute of one row, for pointing a datum at
+		/// </summary>
+		/// <param name="slot">the slot of the attribute</param>
+		/// <param name="row">the row</param>
+		/// <returns>the first of the attribute's values in that row</returns>
+		/// <exception cref="runtime_error">throws an exception if the slot has no column</exception>
+		void* Data(size_t slot, size_t row);
+
+		/// <summary>
+		/// returns one chunk of a column, for walking an attribute of every instance in a straight line
+		/// holds s_ChunkRows rows, each with as many values as the attribute's signature has
+		/// </summary>
+		/// <typeparam name="T">the type of the attribute</typeparam>
+		/// <param name="slot">the slot of the attribute</param>
+		/// <param name="chunk">the index of the chunk</param>
+		/// <returns>the first value in the chunk</returns>
+		/// <exception cref="runtime_error">throws an exception if the slot has no column or T isn't its type</exception>
+		template<typename T>
+		T* Chunk(size_t slot, size_t chunk);
+
+		/// <summary>
+		/// returns the number of chunks in every column
+		/// </summary>
+		/// <returns>the number of chunks</returns>
+		size_t ChunkCount() const;
+
+		/// <summary>
+		/// returns the number of rows that have ever been handed out, live or released
+		/// </summary>
+		/// <returns>one past the highest row</returns>
+		size_t RowCount() const;
+
+		/// <summary>
+		/// returns whether or not a row belongs to an instance right now
+		/// </summary>
+		/// <param name="row">the row to check</param>
+		/// <returns>whether or not the row is live</returns>
+		bool IsLive(size_t row) const;
+
+		/// <summary>
+		/// returns the number of rows that belong to an instance right now
+		/// </summary>
+		/// <returns>the number of live rows</returns>
+		size_t LiveCount();
+
+	private:
+		/// <summary>
+		/// one attribute's values for every row
+		/// </summary>
+		struct Column final
+		{
+			/// <summary>
+			/// the type of the values, UNKNOWN for slots without a column
+			/// </summary>
+			Datum::DatumTypes m_Type = Datum::DatumTypes::UNKNOWN;
+
+			/// <summary>
+			/// the number of values in each row
+			/// </summary>
+			size_t m_Width = 0;
+
+			/// <summary>
+			/// the size of one value in bytes
+			/// </summary>
+			size_t m_ElementSize = 0;
+
+			/// <summary>
+			/// the chunks, each holding s_ChunkRows rows
+			/// </summary>
+			Vector<std::uint8_t*> m_Chunks;
+		};
+
+		/// <summary>
+		/// returns the column of a slot
+		/// </summary>
+		/// <param name="slot">the slot of the attribute</param>
+		/// <returns>the column</returns>
+		/// <exception cref="runtime_error">throws an exception if the slot has no column</exception>
+		Column& ColumnAt(size_t slot);
+
+		/// <summary>
+		/// returns the values of one row in a column
+		/// </summary>
+		/// <param name="column">the column</param>
+		/// <param name="row">the row</param>
+		/// <returns>the first of the row's values</returns>
+		static std::uint8_t* RowAt(Column& column, size_t row);
+
+		/// <summary>
+		/// adds a chunk to the end of every column
+		/// </summary>
+		void AddChunk();
+
+		/// <summary>
+		/// zeroes every value in a row and empties its strings
+		/// </summary>
+		/// <param name="row">the row to reset</param>
+		void ResetRow(size_t row);
+
+		/// <summary>
+		/// returns the datum type of a c++ type
+		/// </summary>
+		/// <typeparam name="T">the c++ type</typeparam>
+		/// <returns>the datum type, UNKNOWN if no datum type matches</returns>
+		template<typename T>
+		static constexpr Datum::DatumTypes TypeOf();
+
+		/// <summary>
+		/// the size of one value of a type
+		/// </summary>
+		/// <param name="type">the type</param>
+		/// <returns>the size in bytes, zero for tables</returns>
+		static size_t ElementSize(Datum::DatumTypes type);
+
+		/// <summary>
+		/// the columns, indexed by slot, with the this slot and tables left empty
+		/// </summary>
+		Vector<Column> m_Columns;
+
+		/// <summary>
+		/// the rows that were released and can be handed out again
+		/// </summary>
+		Vector<size_t> m_FreeRows;
+
+		/// <summary>
+		/// whether or not each row is live
+		/// </summary>
+		Vector<bool> m_Live;
+
+		/// <summary>
+		/// the number of rows ever handed out
+		/// </summary>
+		size_t m_RowCount = 0;
+
+		/// <summary>
+		/// the number of chunks in every column
+		/// </summary>
+		size_t m_ChunkCount = 0;
+
+		/// <summary>
+		/// guards the free list and adding chunks
+		/// </summary>
+		std::mutex m_Mutex;
+	};
+
+	template<typename T>
+	inline T* ColumnStore::Chunk(size_t slot, size_t chunk)
+	{
+		Column& column = ColumnAt(slot);
+
+		if (column.m_Type != TypeOf<T>())
+		{
+			throw std::runtime_error("Column is not of that type");
+		}
+
+		return reinterpret_cast<T*>(column.m_Chunks[chunk]);
+	}
+
+	template<typename T>
+	inline constexpr Datum::DatumTypes ColumnStore::TypeOf()
+	{
+		if constexpr (std::is_same_v<T, int>)
+		{
+			return Datum::DatumTypes::INTEGER;
+		}
+		else if constexpr (std::is_same_v<T, float>)
+		{
+			return Datum::DatumTypes::FLOAT;
+		}
+		else if constexpr (std::is_same_v<T, std::string>)
+		{
+			return Datum::DatumTypes::STRING;
+		}
+		else if constexpr (std::is_same_v<T, glm::vec4>)
+		{
+			return Datum::DatumTypes::VECTOR;
+		}
+		else if constexpr (std::is_same_v<T, glm::mat4>)
+		{
+			return Datum::DatumTypes::MATRIX;
+		}
+		else if constexpr (std::is_same_v<T, RTTI*>)
+		{
+			return Datum::DatumTypes::POINTER;
+		}
+		else
+		{
+			return Datum::DatumTypes::UNKNOWN;
+		}
+	}
+}
@@ -1,7 +1,8 @@
 #include "pch.h"
-#include <glm/gtx/string_cast.hpp>
 #include "Datum.h"
 #include "DefaultIncrement.h"
+#include "Scope.h"
+#include <new>
 
 using namespace glm;
 using namespace std;
@@ -41,7 +42,15 @@ namespace FieaGameEngine
 	Datum::Datum(Datum&& ToMove) noexcept : 
 		m_Type(ToMove.m_Type), m_Size(ToMove.m_Size), m_Capacity(ToMove.m_Capacity), m_IsExternal(ToMove.m_IsExternal)
 	{
-		m_Data.vp = ToMove.m_Data.vp;
+		if (ToMove.IsInline())
+		{
+			memcpy(m_Inline, ToMove.m_Inline, s_InlineSize);
+			m_Data.vp = m_Inline;
+		}
+		else
+		{
+			m_Data.vp = ToMove.m_Data.vp;
+		}
 
 		ToMove.m_Type = DatumTypes::UNKNOWN;
 		ToMove.m_Capacity = 0;
@@ -61,11 +70,16 @@ namespace FieaGameEngine
 
 			if (!ToCopy.m_IsExternal)
 			{
+				if (!m_IsExternal && m_Type != ToCopy.m_Type)
+				{
+					ReleaseStorage();
+				}
+
 				m_Type = ToCopy.m_Type;
 
-				if (m_Capacity < ToCopy.m_Capacity)
+				if (m_Capacity < ToCopy.m_Size)
 				{
-					Reserve(ToCopy.m_Capacity);
+					Reserve(ToCopy.m_Size);
 				}
 
 				if (m_Type == DatumTypes::STRING)
@@ -85,7 +99,7 @@ namespace FieaGameEngine
 			{
 				if (!m_IsExternal)
 				{
-					free(m_Data.vp);
+					FreeData();
 				}
 				m_Data.vp = ToCopy.m_Data.vp;
 				m_Capacity = ToCopy.m_Capacity;
@@ -104,15 +118,24 @@ namespace FieaGameEngine
 			if (!m_IsExternal)
 			{
 				Clear();
-				free(m_Data.vp);
+				FreeData();
 			}
 
 			m_Type = ToMove.m_Type;
 			m_Size = ToMove.m_Size;
 			m_Capacity = ToMove.m_Capacity;
-			m_Data.vp = ToMove.m_Data.vp;
 			m_IsExternal = ToMove.m_IsExternal;
 
+			if (ToMove.IsInline())
+			{
+				memcpy(m_Inline, ToMove.m_Inline, s_InlineSize);
+				m_Data.vp = m_Inline;
+			}
+			else
+			{
+				m_Data.vp = ToMove.m_Data.vp;
+			}
+
 			ToMove.m_Type = DatumTypes::UNKNOWN;
 			ToMove.m_Capacity = 0;
 			ToMove.m_Size = 0;
@@ -149,14 +172,14 @@ namespace FieaGameEngine
 	Datum& Datum::operator=(int value)
 	{
 		SetType(DatumTypes::INTEGER);
-		Clear();
-		
+
 		if (m_IsExternal)
 		{
 			Set(value);
 		}
 		else
 		{
+			Clear();
 			PushBack(value);
 		}
 
@@ -234,16 +257,8 @@ namespace FieaGameEngine
 	Datum& Datum::operator=(Scope& value)
 	{
 		SetType(DatumTypes::TABLE);
-		
-		if (m_IsExternal)
-		{
-			Set(value);
-		}
-		else
-		{
-			Clear();
-			PushBack(value);
-		}
+		PlacedCheck(value, 0);
+		Set(value);
 
 		return *this;
 	}
@@ -286,8 +301,43 @@ namespace FieaGameEngine
 				throw std::runtime_error("Type has not been set");
 			}
 
-			void* data = realloc(m_Data.vp, capacity * m_SizeMap[static_cast<int>(m_Type)]);
-			assert(data != nullptr);
+			ExternalCheck();
+
+			size_t typeSize = m_SizeMap[static_cast<int>(m_Type)];
+
+			if (m_Data.vp == nullptr && m_Type != DatumTypes::STRING && capacity * typeSize <= s_InlineSize)
+			{
+				m_Data.vp = m_Inline;
+				m_Capacity = s_InlineSize / typeSize;
+				return;
+			}
+
+			void* data;
+			if (IsInline())
+			{
+				data = malloc(capacity * typeSize);
+				assert(data != nullptr);
+				memcpy(data, m_Inline, m_Size * typeSize);
+			}
+			else if (m_Type == DatumTypes::STRING)
+			{
+				//strings can point into themselves, so they are moved into the new buffer rather than copied bytewise
+				std::string* strings = static_cast<std::string*>(malloc(capacity * typeSize));
+				assert(strings != nullptr);
+				for (size_t i = 0; i < m_Size; ++i)
+				{
+					new (strings + i) std::string(std::move(m_Data.s[i]));
+					m_Data.s[i].~string();
+				}
+				free(m_Data.vp);
+				data = strings;
+			}
+			else
+			{
+				data = realloc(m_Data.vp, capacity * typeSize);
+				assert(data != nullptr);
+			}
+
 			m_Data.vp = data;
 			m_Capacity = capacity;
 		}
@@ -344,6 +394,11 @@ namespace FieaGameEngine
 	void Datum::PopBack()
 	{
 		ExternalCheck();
+		if (m_Type == DatumTypes::TABLE)
+		{
+			OrphanedCheck(m_Size - 1);
+		}
+
 		if (m_Type == DatumTypes::STRING)
 		{
 			m_Data.s[m_Size - 1].~string();
@@ -358,14 +413,32 @@ namespace FieaGameEngine
 		{
 			if (m_Type == DatumTypes::STRING)
 			{
-				m_Data.s[index].~string();
+				for (size_t i = index; i + 1 < m_Size; ++i)
+				{
+					m_Data.s[i] = std::move(m_Data.s[i + 1]);
+				}
+				PopBack();
+				return;
+			}
+
+			if (m_Type == DatumTypes::TABLE)
+			{
+				OrphanedCheck(index);
 			}
 
 			char* destination = m_Data.c + (index * m_SizeMap[static_cast<int>(m_Type)]);
 			char* source = destination + m_SizeMap[static_cast<int>(m_Type)];
-			size_t bytes = (m_Size - index) * m_SizeMap[static_cast<int>(m_Type)];
+			size_t bytes = (m_Size - index - 1) * m_SizeMap[static_cast<int>(m_Type)];
 			memmove(destination, source, bytes);
 			--m_Size;
+
+			if (m_Type == DatumTypes::TABLE)
+			{
+				for (size_t i = index; i < m_Size; ++i)
+				{
+					m_Data.t[i]->m_ParentIndex = i;
+				}
+			}
 		}
 	}
 
@@ -384,10 +457,10 @@ namespace FieaGameEngine
 			returnString = m_Data.s[index];
 			break;
 		case DatumTypes::VECTOR:
-			returnString = glm::to_string(m_Data.v[index]);
+			returnString = GlmText::ToString(m_Data.v[index]);
 			break;
 		case DatumTypes::MATRIX:
-			returnString = glm::to_string(m_Data.m[index]);
+			returnString = GlmText::ToString(m_Data.m[index]);
 			break;
 		case DatumTypes::POINTER:
 			returnString = m_Data.p[index]->ToString();
@@ -585,6 +658,7 @@ namespace FieaGameEngine
 		TypeCheck(DatumTypes::INTEGER);
 		BoundsCheck(index);
 		m_Data.i[index] = value;
+		Written();
 	}
 
 	void FieaGameEngine::Datum::Set(float value, size_t index)
@@ -592,14 +666,23 @@ namespace FieaGameEngine
 		TypeCheck(DatumTypes::FLOAT);
 		BoundsCheck(index);
 		m_Data.f[index] = value;
+		Written();
 	}
 
 	void FieaGameEngine::Datum::Set(const std::string& value, size_t index)
 	{
 		TypeCheck(DatumTypes::STRING);
 		BoundsCheck(index);
-		m_Data.s[index].~string();
 		m_Data.s[index] = value;
+		Written();
+	}
+
+	void FieaGameEngine::Datum::Set(std::string&& value, size_t index)
+	{
+		TypeCheck(DatumTypes::STRING);
+		BoundsCheck(index);
+		m_Data.s[index] = std::move(value);
+		Written();
 	}
 
 	void FieaGameEngine::Datum::Set(const glm::vec4& value, size_t index)
@@ -608,6 +691,7 @@ namespace FieaGameEngine
 		BoundsCheck(index);
 
 		m_Data.v[index] = value;
+		Written();
 	}
 
 	void FieaGameEngine::Datum::Set(const glm::mat4& value, size_t index)
@@ -616,14 +700,17 @@ namespace FieaGameEngine
 		BoundsCheck(index);
 
 		m_Data.m[index] = value;
+		Written();
 	}
 
 	void Datum::Set(Scope& value, size_t index)
 	{
 		TypeCheck(DatumTypes::TABLE);
 		BoundsCheck(index);
+		PlacedCheck(value, index);
 
 		m_Data.t[index] = &value;
+		Written();
 	}
 
 	void FieaGameEngine::Datum::Set(RTTI*& value, size_t index)
@@ -632,6 +719,7 @@ namespace FieaGameEngine
 		BoundsCheck(index);
 
 		m_Data.p[index] = value;
+		Written();
 	}
 
 #pragma endregion Set Overloads
@@ -649,6 +737,7 @@ namespace FieaGameEngine
 		m_Size = size;
 		m_Capacity = size;
 		m_Type = type;
+		Written();
 	}
 
 	void Datum::SetStorage(int* arrayPtr, size_t size)
@@ -681,6 +770,56 @@ namespace FieaGameEngine
 		return m_IsExternal;
 	}
 
+	void Datum::Watch()
+	{
+		m_IsWatched = true;
+	}
+
+	std::uint64_t Datum::WatchedWriteVersion()
+	{
+		return s_WatchedWrites.load(std::memory_order_relaxed);
+	}
+
+	void Datum::Written()
+	{
+		if (m_IsWatched)
+		{
+			s_WatchedWrites.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	void Datum::PushBackRange(const void* values, size_t count, DatumTypes type)
+	{
+		if (type != DatumTypes::INTEGER && type != DatumTypes::FLOAT && type != DatumTypes::VECTOR && type != DatumTypes::MATRIX)
+		{
+			throw std::runtime_error("Type cannot be copied byte for byte");
+		}
+
+		SetType(type);
+
+		if (count == 0)
+		{
+			return;
+		}
+
+		size_t typeSize = m_SizeMap[static_cast<int>(type)];
+
+		if (m_IsExternal)
+		{
+			if (count > m_Size)
+			{
+				throw std::runtime_error("Values do not fit in the external storage");
+			}
+
+			memcpy(m_Data.vp, values, count * typeSize);
+			return;
+		}
+
+		Reserve(m_Size + count);
+		memcpy(m_Data.c + m_Size * typeSize, values, count * typeSize);
+		m_Size += count;
+	}
+
 	void Datum::SetStorage(RTTI** arrayPtr, size_t size)
 	{
 		SetStorage(reinterpret_cast<void*>(arrayPtr), size, DatumTypes::POINTER);
@@ -712,6 +851,22 @@ namespace FieaGameEngine
 		}
 	}
 
+	void Datum::PlacedCheck(const Scope& value, size_t index) const
+	{
+		if (value.m_ParentDatum != this || value.m_ParentIndex != index)
+		{
+			throw std::runtime_error("Scopes are put in tables through Scope, not set directly");
+		}
+	}
+
+	void Datum::OrphanedCheck(size_t index) const
+	{
+		if (index < m_Size && m_Data.t[index]->m_Parent != nullptr)
+		{
+			throw std::runtime_error("Scopes are taken out of tables through Scope::Orphan");
+		}
+	}
+
 	void Datum::Clear()
 	{
 		ExternalCheck();
@@ -818,7 +973,34 @@ namespace FieaGameEngine
 		{
 			Clear();
 
+			FreeData();
+		}
+	}
+
+	bool Datum::IsInline() const
+	{
+		return m_Data.vp == m_Inline;
+	}
+
+	void Datum::FreeData()
+	{
+		if (!m_IsExternal && !IsInline())
+		{
 			free(m_Data.vp);
 		}
 	}
+
+	void Datum::ReleaseStorage()
+	{
+		if (!m_IsExternal)
+		{
+			Clear();
+			FreeData();
+		}
+
+		m_Data.vp = nullptr;
+		m_Capacity = 0;
+		m_Size = 0;
+		m_IsExternal = false;
+	}
 }
\ No newline at end of file
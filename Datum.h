@@ -1,5 +1,7 @@
 #pragma once
 #include <glm/glm.hpp>
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <functional>
 #include <map>
@@ -84,6 +86,7 @@ namespace FieaGameEngine
 		/// <summary>
 		/// assigns the datum to the given value as though it were one instance
 		/// one overload for each datum type
+		/// a scope can only be assigned to the table that already holds it, at index 0, see Set
 		/// </summary>
 		/// <param name="value">the value to be set</param>
 		/// <returns>the datum with the new value</returns>
@@ -125,7 +128,7 @@ namespace FieaGameEngine
 		void Reserve(size_t capacity);
 
 		/// <summary>
-		/// resizes the datum to the given size\
+		/// resizes the datum to the given size
 		/// if it is larger, it expands the array and initializes default values in the extra space
 		/// if it is smaller, it destructs the extra elements 
 		/// </summary>
@@ -173,6 +176,12 @@ namespace FieaGameEngine
 		template <typename IncrementFunctor = DefaultIncrement>
 		void PushBack(const std::string& value);
 
+		/// <summary>
+		/// adds a string to the end of the array, moving it in instead of copying it
+		/// </summary>
+		template <typename IncrementFunctor = DefaultIncrement>
+		void PushBack(std::string&& value);
+
 		/// <summary>
 		/// adds a vector to the end of the array
 		/// </summary>
@@ -191,9 +200,22 @@ namespace FieaGameEngine
 		template <typename IncrementFunctor = DefaultIncrement>
 		void PushBack(RTTI* const value);
 
+		/// <summary>
+		/// adds a run of values to the end of the array in one go, growing it at most once and copying them byte for byte
+		/// only for integers, floats, vectors, and matrices
+		/// external storage can't grow, so the values are copied over it from the start instead
+		/// </summary>
+		/// <param name="values">the first value, it doesn't have to be aligned</param>
+		/// <param name="count">the number of values</param>
+		/// <param name="type">the type of the values</param>
+		/// <exception cref="runtime_error">throws an exception if the type can't be copied byte for byte, doesn't match, or doesn't fit in external storage</exception>
+		void PushBackRange(const void* values, size_t count, DatumTypes type);
+
 		/// <summary>
 		/// removes the final value of the array
+		/// a scope has to be orphaned before it can be popped off a table, see Scope::Orphan
 		/// </summary>
+		/// <exception cref="runtime_error">throws an exception if the final value is a scope that still has a parent</exception>
 		void PopBack();
 
 		/// <summary>
@@ -226,12 +248,16 @@ namespace FieaGameEngine
 		/// <summary>
 		/// sets the value at the given index to the passed in value
 		/// one overload for each datum type
+		/// scopes are put in tables through Scope, which keeps each one's place in its parent, so setting a scope only
+		/// re-points a slot at the scope already recorded as being there, the way moving a scope does
 		/// </summary>
 		/// <param name="value">the value to be set</param>
 		/// <param name="index">the index to be set at</param>
+		/// <exception cref="runtime_error">throws an exception if a scope isn't already recorded as being in this datum at the index</exception>
 		void Set(int value, size_t index = 0);
 		void Set(float value, size_t index = 0);
 		void Set(const std::string& value, size_t index = 0);
+		void Set(std::string&& value, size_t index = 0);
 		void Set(const glm::vec4& value, size_t index = 0);
 		void Set(const glm::mat4& value, size_t index = 0);
 		void Set(Scope& value, size_t index = 0);
@@ -242,9 +268,15 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="toSet">the value to be set</param>
 		/// <param name="index">the index to be set at</param>
+		/// <exception cref="runtime_error">throws an exception if the string isn't a valid value of the type</exception>
 		template<typename T>
 		void SetFromString(std::string toSet, size_t index = 0);
 
+		/// <summary>
+		/// adds a value to the end of the array based on a string
+		/// </summary>
+		/// <param name="toSet">the value to be added</param>
+		/// <exception cref="runtime_error">throws an exception if the string isn't a valid value of the type</exception>
 		template<typename T>
 		void PushBackFromString(std::string toSet);
 
@@ -288,9 +320,11 @@ namespace FieaGameEngine
 		void Remove(RTTI* toRemove);
 
 		/// <summary>
-		/// removes a value at a given index
+		/// removes a value at a given index, the values after it shift down to keep their order
+		/// a scope has to be orphaned before it can be removed from a table, the scopes after it are told their new index
 		/// </summary>
 		/// <param name="index">the index to remove at</param>
+		/// <exception cref="runtime_error">throws an exception if the value is a scope that still has a parent</exception>
 		void RemoveAt(size_t index);
 
 		/// <summary>
@@ -331,6 +365,20 @@ namespace FieaGameEngine
 		/// <returns></returns>
 		bool IsExternal() const;
 
+		/// <summary>
+		/// watches the datum, from then on every Set through it and every SetStorage bumps WatchedWriteVersion
+		/// for owners that keep something worked out from a prescribed attribute, so they can tell when to work it out again
+		/// prescribed datums are external, so assigning a value to one goes through Set too
+		/// writes through the reference Get returns go around it, and copies of the datum aren't watched
+		/// </summary>
+		void Watch();
+
+		/// <summary>
+		/// returns the number of writes there have been to watched datums, shared by every datum
+		/// </summary>
+		/// <returns>the watched write version</returns>
+		static std::uint64_t WatchedWriteVersion();
+
 	private:
 		/// <summary>
 		/// adds a scope to the end of the array
@@ -373,6 +421,38 @@ namespace FieaGameEngine
 		/// <exception cref="runtime_error">throws an exception if the datum is externally stored</exception>
 		void ExternalCheck() const;
 
+		/// <summary>
+		/// helper function to make sure a scope is recorded as being in this table at the given index
+		/// </summary>
+		/// <param name="value">the scope to be checked</param>
+		/// <param name="index">the index it should be at</param>
+		/// <exception cref="runtime_error">throws an exception if the scope thinks it is anywhere else</exception>
+		void PlacedCheck(const Scope& value, size_t index) const;
+
+		/// <summary>
+		/// helper function to make sure the scope at an index of a table has been orphaned, so it can be taken out
+		/// </summary>
+		/// <param name="index">the index to be checked</param>
+		/// <exception cref="runtime_error">throws an exception if the scope still has a parent</exception>
+		void OrphanedCheck(size_t index) const;
+
+		/// <summary>
+		/// returns whether or not the datum's values are in its inline buffer
+		/// </summary>
+		/// <returns>whether or not the values are stored inline</returns>
+		bool IsInline() const;
+
+		/// <summary>
+		/// frees the datum's heap buffer, if it has one
+		/// does nothing for inline or external storage
+		/// </summary>
+		void FreeData();
+
+		/// <summary>
+		/// gives up the datum's buffer entirely so it can be reserved again for a different type
+		/// </summary>
+		void ReleaseStorage();
+
 		/// <summary>
 		/// the array of pointers to the data
 		/// stored as a union so that it may be manipulated without prior knowledge of the type
@@ -472,10 +552,36 @@ namespace FieaGameEngine
 		/// </summary>
 		DatumValues	m_Data;
 
+		/// <summary>
+		/// the size of the inline buffer in bytes, enough for one vector or a few ints, floats or pointers
+		/// </summary>
+		static constexpr size_t s_InlineSize = 16;
+
+		/// <summary>
+		/// storage for small arrays of trivially copyable types so they don't need the heap
+		/// m_Data points in here when it's in use, the datum only goes to the heap once it outgrows it
+		/// </summary>
+		alignas(16) std::uint8_t m_Inline[s_InlineSize];
+
 		/// <summary>
 		/// whether or not the datum is stored externally
 		/// </summary>
 		bool m_IsExternal = false;
+
+		/// <summary>
+		/// whether or not writes to the datum bump the watched write version, see Watch
+		/// </summary>
+		bool m_IsWatched = false;
+
+		/// <summary>
+		/// the number of writes there have been to watched datums
+		/// </summary>
+		inline static std::atomic<std::uint64_t> s_WatchedWrites{ 0 };
+
+		/// <summary>
+		/// bumps the watched write version if the datum is watched, called by every Set
+		/// </summary>
+		void Written();
 	};
 }
 
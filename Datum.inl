@@ -1,5 +1,6 @@
 #include <glm/glm.hpp>
 #include "Datum.h"
+#include "GlmText.h"
 
 using namespace glm;
 using namespace std;
@@ -47,6 +48,13 @@ namespace FieaGameEngine
 		new(m_Data.s + (m_Size - 1))string(value);
 	}
 
+	template <typename IncrementFunctor>
+	inline void Datum::PushBack(std::string&& value)
+	{
+		PushBackPrep<IncrementFunctor>(DatumTypes::STRING);
+		new(m_Data.s + (m_Size - 1))string(std::move(value));
+	}
+
 	template <typename IncrementFunctor>
 	inline void Datum::PushBack(const glm::vec4& value)
 	{
@@ -474,24 +482,13 @@ namespace FieaGameEngine
 	template<>
 	inline void Datum::SetFromString<glm::vec4>(std::string toSet, size_t index)
 	{
-		float float1;
-		float float2;
-		float float3;
-		float float4;
-
-		sscanf_s(toSet.c_str(), "vec4(%f, %f, %f, %f)", &float1, &float2, &float3, &float4);
-		glm::vec4 newVec(float1, float2, float3, float4);
-		Set(newVec, index);
+		Set(GlmText::ParseVector(toSet), index);
 	}
 
 	template<>
 	inline void Datum::SetFromString<glm::mat4>(std::string toSet, size_t index)
 	{
-		float float1, float2, float3, float4, float5, float6, float7, float8, float9, float10, float11, float12, float13, float14, float15, float16;
-
-		sscanf_s(toSet.c_str(), "mat4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))", &float1, &float2, &float3, &float4, &float5, &float6, &float7, &float8, &float9, &float10, &float11, &float12, &float13, &float14, &float15, &float16);
-		glm::mat4 newMat(float1, float2, float3, float4, float5, float6, float7, float8, float9, float10, float11, float12, float13, float14, float15, float16);
-		Set(newMat, index);
+		Set(GlmText::ParseMatrix(toSet), index);
 	}
 
 	template<>
@@ -509,24 +506,13 @@ namespace FieaGameEngine
 	template<>
 	inline void Datum::PushBackFromString<glm::vec4>(std::string toSet)
 	{
-		float float1;
-		float float2;
-		float float3;
-		float float4;
-
-		sscanf_s(toSet.c_str(), "vec4(%f, %f, %f, %f)", &float1, &float2, &float3, &float4);
-		glm::vec4 newVec(float1, float2, float3, float4);
-		PushBack(newVec);
+		PushBack(GlmText::ParseVector(toSet));
 	}
 
 	template<>
 	inline void Datum::PushBackFromString<glm::mat4>(std::string toSet)
 	{
-		float float1, float2, float3, float4, float5, float6, float7, float8, float9, float10, float11, float12, float13, float14, float15, float16;
-
-		sscanf_s(toSet.c_str(), "mat4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))", &float1, &float2, &float3, &float4, &float5, &float6, &float7, &float8, &float9, &float10, &float11, &float12, &float13, &float14, &float15, &float16);
-		glm::mat4 newMat(float1, float2, float3, float4, float5, float6, float7, float8, float9, float10, float11, float12, float13, float14, float15, float16);
-		PushBack(newMat);
+		PushBack(GlmText::ParseMatrix(toSet));
 	}
 
 #pragma endregion PushBackFromString templates
@@ -1,8 +1,54 @@
 #pragma once
+#include <cstdint>
 
 namespace FieaGameEngine
 {
-	template<typename TKey>
+	/// <summary>
+	/// the old hash, sums 31 * every byte
+	/// cheap, but every permutation of a key collides, so only opt into it on purpose
+	/// </summary>
+	struct AdditiveHashPolicy final
+	{
+		/// <summary>
+		/// hashes a run of bytes
+		/// </summary>
+		/// <param name="key">the bytes to be hashed</param>
+		/// <param name="size">the number of bytes</param>
+		/// <returns>the hash</returns>
+		static size_t Hash(const std::uint8_t* key, size_t size);
+	};
+
+	/// <summary>
+	/// wyhash style hash for short keys, with an xxh3 style striped loop (sse2 when available) for long ones
+	/// </summary>
+	struct FastHashPolicy final
+	{
+		/// <summary>
+		/// hashes a run of bytes
+		/// </summary>
+		/// <param name="key">the bytes to be hashed</param>
+		/// <param name="size">the number of bytes</param>
+		/// <returns>the hash</returns>
+		static size_t Hash(const std::uint8_t* key, size_t size);
+	};
+
+	/// <summary>
+	/// the policy DefaultHash uses when a map doesn't name one
+	/// define FIEA_ADDITIVE_HASH to go back to the additive hash everywhere
+	/// </summary>
+#ifdef FIEA_ADDITIVE_HASH
+	using DefaultHashPolicy = AdditiveHashPolicy;
+#else
+	using DefaultHashPolicy = FastHashPolicy;
+#endif
+
+	/// <summary>
+	/// default hash functor for the hash maps
+	/// hashes the raw bytes of the key, strings and c strings hash their characters instead
+	/// </summary>
+	/// <typeparam name="TKey">the type of key being hashed</typeparam>
+	/// <typeparam name="HashPolicy">which byte hash to use, lets a single map opt in or out of the default</typeparam>
+	template<typename TKey, typename HashPolicy = DefaultHashPolicy>
 	struct DefaultHash final
 	{
 		size_t operator()(const TKey& key) const;
@@ -10,4 +56,4 @@ namespace FieaGameEngine
 
 }
 
-#include "DefaultHash.inl"
\ No newline at end of file
+#include "DefaultHash.inl"
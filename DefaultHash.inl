@@ -3,6 +3,15 @@
 #include <string.h>
 #include <string>
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FIEA_HASH_SSE2
+#endif
+
 namespace FieaGameEngine
 {
 	const size_t HashPrime = 31;
@@ -19,82 +28,312 @@ namespace FieaGameEngine
 		return hash;
 	}
 
-	template<typename TKey>
-	inline size_t DefaultHash<TKey>::operator()(const TKey& key) const
+#pragma region FastHash
+	namespace FastHashDetail
+	{
+		const std::uint64_t Secret[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+		const std::uint64_t LaneSecret[8] = { 0xbe4ba423396cfeb8ull, 0x1cad21f72c81017cull, 0xdb979083e96dd4deull, 0x1f67b3b7a4a44072ull,
+			0x78e5c0cc4ee679cbull, 0x2172ffcc7dd05a82ull, 0x8e2443f7744608b8ull, 0x4c263a81e69035e0ull };
+		const std::uint64_t StripeStep = 0x9E3779B97F4A7C15ull;
+		const std::uint32_t ScramblePrime = 0x9E3779B1u;
+
+		//bytes per stripe and stripes per scramble for the long key loop
+		const size_t StripeSize = 64;
+		const size_t StripesPerBlock = 16;
+		const size_t LongKeySize = 256;
+
+		//128 bit multiply, low half into a and high half into b
+		inline void Multiply(std::uint64_t& a, std::uint64_t& b)
+		{
+#if defined(__SIZEOF_INT128__)
+			__uint128_t product = static_cast<__uint128_t>(a) * b;
+			a = static_cast<std::uint64_t>(product);
+			b = static_cast<std::uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+			a = _umul128(a, b, &b);
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+			std::uint64_t high = __umulh(a, b);
+			a = a * b;
+			b = high;
+#else
+			std::uint64_t aHigh = a >> 32, aLow = static_cast<std::uint32_t>(a);
+			std::uint64_t bHigh = b >> 32, bLow = static_cast<std::uint32_t>(b);
+			std::uint64_t highHigh = aHigh * bHigh, highLow = aHigh * bLow, lowHigh = aLow * bHigh, lowLow = aLow * bLow;
+			std::uint64_t middle = highLow + (lowLow >> 32) + static_cast<std::uint32_t>(lowHigh);
+			a = (middle << 32) | static_cast<std::uint32_t>(lowLow);
+			b = highHigh + (middle >> 32) + (lowHigh >> 32);
+#endif
+		}
+
+		inline std::uint64_t Mix(std::uint64_t a, std::uint64_t b)
+		{
+			Multiply(a, b);
+			return a ^ b;
+		}
+
+		inline std::uint64_t Read8(const std::uint8_t* p)
+		{
+			std::uint64_t value;
+			memcpy(&value, p, sizeof(value));
+			return value;
+		}
+
+		inline std::uint64_t Read4(const std::uint8_t* p)
+		{
+			std::uint32_t value;
+			memcpy(&value, p, sizeof(value));
+			return value;
+		}
+
+		inline std::uint64_t Read3(const std::uint8_t* p, size_t size)
+		{
+			return (static_cast<std::uint64_t>(p[0]) << 16) | (static_cast<std::uint64_t>(p[size >> 1]) << 8) | p[size - 1];
+		}
+
+		//folds 64 byte stripes into 8 accumulators, xxh3 style
+		//the scalar and sse2 versions produce the same accumulators, so hashes don't depend on the build
+		inline void AccumulateStripes(std::uint64_t* accumulators, const std::uint8_t* key, size_t stripes)
+		{
+#ifdef FIEA_HASH_SSE2
+			__m128i acc[4];
+			__m128i laneKeys[4];
+			for (size_t lane = 0; lane < 4; ++lane)
+			{
+				acc[lane] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(accumulators + lane * 2));
+				laneKeys[lane] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(LaneSecret + lane * 2));
+			}
+
+			const __m128i prime = _mm_set1_epi32(static_cast<int>(ScramblePrime));
+
+			for (size_t stripe = 0; stripe < stripes; ++stripe)
+			{
+				const __m128i offset = _mm_set1_epi64x(static_cast<long long>(StripeStep * stripe));
+				const std::uint8_t* data = key + stripe * StripeSize;
+
+				for (size_t lane = 0; lane < 4; ++lane)
+				{
+					__m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + lane * 16));
+					__m128i keyed = _mm_xor_si128(value, _mm_add_epi64(laneKeys[lane], offset));
+					__m128i product = _mm_mul_epu32(keyed, _mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+					acc[lane] = _mm_add_epi64(acc[lane], _mm_add_epi64(product, _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2))));
+				}
+
+				if ((stripe + 1) % StripesPerBlock == 0)
+				{
+					for (size_t lane = 0; lane < 4; ++lane)
+					{
+						__m128i scrambled = _mm_xor_si128(_mm_xor_si128(acc[lane], _mm_srli_epi64(acc[lane], 47)), laneKeys[lane]);
+						__m128i low = _mm_mul_epu32(scrambled, prime);
+						__m128i high = _mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(scrambled, 32), prime), 32);
+						acc[lane] = _mm_add_epi64(low, high);
+					}
+				}
+			}
+
+			for (size_t lane = 0; lane < 4; ++lane)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(accumulators + lane * 2), acc[lane]);
+			}
+#else
+			for (size_t stripe = 0; stripe < stripes; ++stripe)
+			{
+				const std::uint64_t offset = StripeStep * stripe;
+				const std::uint8_t* data = key + stripe * StripeSize;
+
+				for (size_t lane = 0; lane < 8; ++lane)
+				{
+					std::uint64_t value = Read8(data + lane * 8);
+					std::uint64_t keyed = value ^ (LaneSecret[lane] + offset);
+					accumulators[lane ^ 1] += value;
+					accumulators[lane] += (keyed & 0xFFFFFFFFull) * (keyed >> 32);
+				}
+
+				if ((stripe + 1) % StripesPerBlock == 0)
+				{
+					for (size_t lane = 0; lane < 8; ++lane)
+					{
+						std::uint64_t scrambled = accumulators[lane] ^ (accumulators[lane] >> 47) ^ LaneSecret[lane];
+						accumulators[lane] = scrambled * ScramblePrime;
+					}
+				}
+			}
+#endif
+		}
+
+		inline std::uint64_t Hash(const std::uint8_t* key, size_t size, std::uint64_t seed)
+		{
+			const std::uint8_t* p = key;
+			seed ^= Mix(seed ^ Secret[0], Secret[1]);
+			std::uint64_t a = 0, b = 0;
+
+			if (size <= 16)
+			{
+				if (size >= 4)
+				{
+					a = (Read4(p) << 32) | Read4(p + ((size >> 3) << 2));
+					b = (Read4(p + size - 4) << 32) | Read4(p + size - 4 - ((size >> 3) << 2));
+				}
+				else if (size > 0)
+				{
+					a = Read3(p, size);
+				}
+			}
+			else
+			{
+				size_t remaining = size;
+
+				if (remaining > LongKeySize)
+				{
+					std::uint64_t accumulators[8];
+					for (size_t lane = 0; lane < 8; ++lane)
+					{
+						accumulators[lane] = seed ^ LaneSecret[lane];
+					}
+
+					size_t stripes = (remaining - 1) / StripeSize;
+					AccumulateStripes(accumulators, p, stripes);
+					p += stripes * StripeSize;
+					remaining -= stripes * StripeSize;
+
+					for (size_t lane = 0; lane < 8; lane += 2)
+					{
+						seed ^= Mix(accumulators[lane] ^ Secret[lane >> 1], accumulators[lane + 1] ^ seed);
+					}
+				}
+				else if (remaining > 48)
+				{
+					std::uint64_t first = seed, second = seed;
+					do
+					{
+						seed = Mix(Read8(p) ^ Secret[1], Read8(p + 8) ^ seed);
+						first = Mix(Read8(p + 16) ^ Secret[2], Read8(p + 24) ^ first);
+						second = Mix(Read8(p + 32) ^ Secret[3], Read8(p + 40) ^ second);
+						p += 48;
+						remaining -= 48;
+					} while (remaining > 48);
+
+					seed ^= first ^ second;
+				}
+
+				while (remaining > 16)
+				{
+					seed = Mix(Read8(p) ^ Secret[1], Read8(p + 8) ^ seed);
+					p += 16;
+					remaining -= 16;
+				}
+
+				//the last 16 bytes, reading back over already hashed bytes if the key isn't a multiple of 16
+				a = Read8(p + remaining - 16);
+				b = Read8(p + remaining - 8);
+			}
+
+			a ^= Secret[1];
+			b ^= seed;
+			Multiply(a, b);
+			return Mix(a ^ Secret[0] ^ size, b ^ Secret[1]);
+		}
+	}
+
+	/// <summary>
+	/// fast non-cryptographic hash of a run of bytes
+	/// wyhash for keys up to 256 bytes, striped accumulators for anything longer
+	/// </summary>
+	/// <param name="key">the bytes to be hashed</param>
+	/// <param name="size">the number of bytes</param>
+	/// <param name="seed">changes the whole hash family, 0 unless you need independent hashes</param>
+	/// <returns>the 64 bit hash</returns>
+	inline std::uint64_t FastHash(const std::uint8_t* key, size_t size, std::uint64_t seed = 0)
+	{
+		return FastHashDetail::Hash(key, size, seed);
+	}
+#pragma endregion FastHash
+
+	inline size_t AdditiveHashPolicy::Hash(const std::uint8_t* key, size_t size)
+	{
+		return AdditiveHash(key, size);
+	}
+
+	inline size_t FastHashPolicy::Hash(const std::uint8_t* key, size_t size)
+	{
+		return static_cast<size_t>(FastHash(key, size));
+	}
+
+	template<typename TKey, typename HashPolicy>
+	inline size_t DefaultHash<TKey, HashPolicy>::operator()(const TKey& key) const
 	{
 		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(&key);
 
-		return AdditiveHash(data, sizeof(TKey));
+		return HashPolicy::Hash(data, sizeof(TKey));
 	}
 
-	template<>
-	struct DefaultHash<char*>
+	template<typename HashPolicy>
+	struct DefaultHash<char*, HashPolicy> final
 	{
 		inline size_t operator()(const char* key) const
 		{
 			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
-			
-			return AdditiveHash(data, sizeof(*key));
+
+			return HashPolicy::Hash(data, strlen(key));
 		}
 	};
 
-	template<>
-	struct DefaultHash<const char*>
+	template<typename HashPolicy>
+	struct DefaultHash<const char*, HashPolicy> final
 	{
 		inline size_t operator()(const char* key) const
 		{
 			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
 
-			return AdditiveHash(data, strlen(key));
+			return HashPolicy::Hash(data, strlen(key));
 		}
 	};
 
-	template<>
-	struct DefaultHash<const char* const>
+	template<typename HashPolicy>
+	struct DefaultHash<const char* const, HashPolicy> final
 	{
 		inline size_t operator()(const char* const key) const
 		{
 			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
 
-			return AdditiveHash(data, strlen(key));
+			return HashPolicy::Hash(data, strlen(key));
 		}
 	};
 
-	template<>
-	struct DefaultHash<char* const>
+	template<typename HashPolicy>
+	struct DefaultHash<char* const, HashPolicy> final
 	{
 		inline size_t operator()(char* const key) const
 		{
 			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
 
-			return AdditiveHash(data, sizeof(*key));
+			return HashPolicy::Hash(data, strlen(key));
 		}
 	};
 
-	template<>
-	struct DefaultHash<std::string>
+	template<typename HashPolicy>
+	struct DefaultHash<std::string, HashPolicy> final
 	{
 		inline size_t operator()(const std::string& key) const
 		{
 			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key.c_str());
 
-			return AdditiveHash(data, key.length());
+			return HashPolicy::Hash(data, key.length());
 		}
 	};
 
-	template<>
-	struct DefaultHash<const std::string>
+	template<typename HashPolicy>
+	struct DefaultHash<const std::string, HashPolicy> final
 	{
 		inline size_t operator()(const std::string& key) const
 		{
 			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key.c_str());
 
-			return AdditiveHash(data, key.length());
+			return HashPolicy::Hash(data, key.length());
 		}
 	};
 
-	template<>
-	struct DefaultHash<int>
+	template<typename HashPolicy>
+	struct DefaultHash<int, HashPolicy> final
 	{
 		inline size_t operator()(int key) const
 		{
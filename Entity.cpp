@@ -6,9 +6,11 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(Entity);
 
+	static const Key s_ActionsKey("m_Actions");
+
 	Entity::Entity(RTTI::IdType id) : Attributed(id) 
 	{
-		m_Sector = static_cast<Sector*>(m_Parent);
+		GetPrescribed<s_SectorSlot>() = static_cast<RTTI*>(m_Parent);
 	}
 
 	Entity* Entity::Clone()
@@ -28,13 +30,13 @@ namespace FieaGameEngine
 
 	Sector* Entity::GetSector() const
 	{
-		return m_Sector;
+		return static_cast<Sector*>(GetPrescribed<s_SectorSlot>().Get<RTTI*>());
 	}
 
 	void Entity::SetSector(Sector& toSet)
 	{
-		m_Sector = &toSet;
-		m_Sector->Adopt(*this, "m_Entities");
+		GetPrescribed<s_SectorSlot>() = static_cast<RTTI*>(&toSet);
+		toSet.Adopt(*this, "m_Entities");
 	}
 
 	void Entity::Update(WorldState& worldState)
@@ -54,17 +56,18 @@ namespace FieaGameEngine
 
 	std::string Entity::Name() const
 	{
-		return m_Name;
+		return GetPrescribed<s_NameSlot>().Get<std::string>();
 	}
 
 	void Entity::SetName(const std::string& name)
 	{
-		m_Name = name;
+		GetPrescribed<s_NameSlot>() = name;
 	}
 
 	Datum& Entity::Actions()
 	{
-		return *Find("m_Actions");
+		assert(m_Order[s_ActionsSlot]->first == s_ActionsKey);
+		return GetPrescribed<s_ActionsSlot>();
 	}
 
 	Scope* Entity::CreateAction(const std::string& actionName)
@@ -76,7 +79,7 @@ namespace FieaGameEngine
 			throw::std::runtime_error("Action name not found in factories");
 		}
 
-		Adopt(*action, "m_Actions");
+		Adopt(*action, s_ActionsKey);
 		return action;
 	}
 }
\ No newline at end of file
@@ -94,15 +94,32 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <returns>the array of signatures</returns>
 		static const Vector<Signature> Signatures();
+
+		/// <summary>
+		/// the slot of m_Name, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_NameSlot = 1;
+
+		/// <summary>
+		/// the slot of m_Sector, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_SectorSlot = 2;
+
+		/// <summary>
+		/// the slot of m_Actions, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_ActionsSlot = 3;
 	protected:
 
 		/// <summary>
 		/// the name of the entity
+		/// only read through its datum, since it isn't used when the type is stored in columns
 		/// </summary>
 		std::string m_Name;
 
 		/// <summary>
 		/// the sector that the entity belongs to
+		/// only read through its datum, since it isn't used when the type is stored in columns
 		/// </summary>
 		Sector* m_Sector = nullptr;
 	};
@@ -1,10 +1,24 @@
 #pragma once
 #include "EventPublisher.h"
 #include "EventSubscriber.h"
+#include "EventDispatchTable.h"
 #include "Vector.h"
 
 namespace FieaGameEngine
 {
+	/// <summary>
+	/// gives the route key of an event's message, specialize it for a message type whose events should be routed
+	/// the default gives a null key, so the events go to every subscriber
+	/// </summary>
+	template <typename T>
+	struct EventRoute final
+	{
+		static Key Of(const T&)
+		{
+			return Key();
+		}
+	};
+
 	/// <summary>
 	/// Event class
 	/// Wraps a T and allows for usage of the eventQueue and its notify system
@@ -22,6 +36,13 @@ namespace FieaGameEngine
 		/// <param name="message">the T to copy and wrap as its message</param>
 		Event(const T& message);
 
+		/// <summary>
+		/// event constructor
+		/// takes in a T to move in and wrap as its message
+		/// </summary>
+		/// <param name="message">the T to move in and wrap as its message</param>
+		Event(T&& message);
+
 		/// <summary>
 		/// event default copy constructor
 		/// </summary>
@@ -54,27 +75,39 @@ namespace FieaGameEngine
 		const T& Message() const;
 
 		/// <summary>
-		/// adds a subscriber to the list of subscribers
+		/// returns the message wrapped by this event, so a pooled event can be filled in before it is queued
+		/// </summary>
+		/// <returns>the message wrapped by this event</returns>
+		T& Message();
+
+		/// <summary>
+		/// returns the route key of the message, given by EventRoute
+		/// </summary>
+		/// <returns>the route key of the message</returns>
+		Key RouteKey() const override;
+
+		/// <summary>
+		/// adds a subscriber to the table of subscribers, under the route key it gives
 		/// </summary>
 		/// <param name="subscriber">the subscriber to add</param>
 		static void Subscribe(EventSubscriber& subscriber);
 
 		/// <summary>
-		/// removes a subscriber from the list of subscribers
+		/// removes a subscriber from the table of subscribers
 		/// </summary>
 		/// <param name="subscriber">the subscriber to remove</param>
 		static void Unsubscribe(EventSubscriber& subscriber);
 
 		/// <summary>
-		/// removes all the subscribers from the list and frees the memory
+		/// removes all the subscribers from the table and frees the memory
 		/// </summary>
 		static void UnsubscribeAll();
 
 	private:
 		/// <summary>
-		/// the list of subscribers to this event
+		/// the subscribers to this event
 		/// </summary>
-		static Vector<EventSubscriber*> m_Subscribers;
+		static EventDispatchTable m_Subscribers;
 
 		/// <summary>
 		/// the message wrapped by this event
@@ -3,7 +3,7 @@
 namespace FieaGameEngine
 {
 	template <typename T>
-	Vector<EventSubscriber*> Event<T>::m_Subscribers;
+	EventDispatchTable Event<T>::m_Subscribers;
 
 	template <typename T>
 	RTTI_DEFINITIONS(Event<T>);
@@ -11,28 +11,42 @@ namespace FieaGameEngine
 	template<typename T>
 	inline Event<T>::Event(const T& message) : EventPublisher(m_Subscribers), m_Message(message) {}
 
+	template<typename T>
+	inline Event<T>::Event(T&& message) : EventPublisher(m_Subscribers), m_Message(std::move(message)) {}
+
 	template<typename T>
 	inline const T& Event<T>::Message() const
 	{
 		return m_Message;
 	}
 
+	template<typename T>
+	inline T& Event<T>::Message()
+	{
+		return m_Message;
+	}
+
+	template<typename T>
+	inline Key Event<T>::RouteKey() const
+	{
+		return EventRoute<T>::Of(m_Message);
+	}
+
 	template<typename T>
 	inline void Event<T>::Subscribe(EventSubscriber& subscriber)
 	{
-		m_Subscribers.PushBack(&subscriber);
+		m_Subscribers.Add(subscriber);
 	}
 
 	template<typename T>
 	inline void Event<T>::Unsubscribe(EventSubscriber& subscriber)
 	{
-		m_Subscribers.Remove(&subscriber);
+		m_Subscribers.Remove(subscriber);
 	}
 
 	template<typename T>
 	inline void Event<T>::UnsubscribeAll()
 	{
 		m_Subscribers.Clear();
-		m_Subscribers.ShrinkToFit();
 	}
 }
@@ -0,0 +1,286 @@
+#include "pch.h"
+#include "EventDispatchTable.h"
+#include "EventPublisher.h"
+#include "EventSubscriber.h"
+
+namespace FieaGameEngine
+{
+	EventDispatchTable::DeliveryScope::DeliveryScope(EventDispatchTable& table) : m_Table(table)
+	{
+		++m_Table.m_DeliveryDepth;
+	}
+
+	EventDispatchTable::DeliveryScope::~DeliveryScope()
+	{
+		if (--m_Table.m_DeliveryDepth == 0)
+		{
+			m_Table.ApplyPending();
+		}
+	}
+
+	void EventDispatchTable::Add(EventSubscriber& subscriber)
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+		if (m_Entries.Find(&subscriber) != m_Entries.end())
+		{
+			return;
+		}
+
+		if (m_DeliveryDepth > 0)
+		{
+			if (m_PendingAdds.Find(&subscriber) == m_PendingAdds.end())
+			{
+				m_PendingAdds.PushBack(&subscriber);
+			}
+			return;
+		}
+
+		Insert(subscriber, subscriber.RouteKey());
+	}
+
+	void EventDispatchTable::Remove(EventSubscriber& subscriber)
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+		auto it = m_Entries.Find(&subscriber);
+		if (it == m_Entries.end())
+		{
+			m_PendingAdds.Remove(&subscriber);
+			return;
+		}
+
+		if (m_DeliveryDepth > 0)
+		{
+			m_Routes.At(it->second.m_Route)[it->second.m_Index] = nullptr;
+			m_HasHoles = true;
+		}
+		else
+		{
+			Erase(it->second);
+		}
+
+		m_Entries.Remove(&subscriber);
+	}
+
+	void EventDispatchTable::Clear()
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+		m_PendingAdds.Clear();
+		m_Entries.Clear();
+
+		if (m_DeliveryDepth > 0)
+		{
+			for (auto& route : m_Routes)
+			{
+				for (EventSubscriber*& subscriber : route.second)
+				{
+					subscriber = nullptr;
+				}
+			}
+			m_HasHoles = true;
+			return;
+		}
+
+		m_Routes.Clear();
+	}
+
+	size_t EventDispatchTable::Size() const
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+		return m_Entries.Size() + m_PendingAdds.Size();
+	}
+
+	void EventDispatchTable::Deliver(const EventPublisher& event)
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+		if (m_DeliveryDepth == 0)
+		{
+			Reroute();
+		}
+
+		DeliveryScope scope(*this);
+
+		auto everything = m_Routes.Find(Key());
+		if (everything != m_Routes.end())
+		{
+			Notify(everything->second, event);
+		}
+
+		Key route = event.RouteKey();
+		if (route.IsNull())
+		{
+			return;
+		}
+
+		auto routed = m_Routes.Find(route);
+		if (routed != m_Routes.end())
+		{
+			Notify(routed->second, event);
+		}
+	}
+
+	void EventDispatchTable::Deliver(const Vector<const EventPublisher*>& events)
+	{
+		if (events.IsEmpty())
+		{
+			return;
+		}
+
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+		if (m_DeliveryDepth == 0)
+		{
+			Reroute();
+		}
+
+		DeliveryScope scope(*this);
+
+		auto everything = m_Routes.Find(Key());
+		if (everything != m_Routes.end())
+		{
+			Notify(everything->second, events);
+		}
+
+		FlatHashMap<const Key, Vector<const EventPublisher*>> grouped;
+		for (const EventPublisher* event : events)
+		{
+			Key route = event->RouteKey();
+			if (!route.IsNull() && m_Routes.Find(route) != m_Routes.end())
+			{
+				grouped[route].PushBack(event);
+			}
+		}
+
+		for (auto& group : grouped)
+		{
+			Notify(m_Routes.At(group.first), group.second);
+		}
+	}
+
+	void EventDispatchTable::Insert(EventSubscriber& subscriber, const Key& route)
+	{
+		Vector<EventSubscriber*>& bucket = m_Routes[route];
+		m_Entries[&subscriber] = Entry{ route, bucket.Size() };
+		bucket.PushBack(&subscriber);
+	}
+
+	void EventDispatchTable::Erase(const Entry& entry)
+	{
+		auto bucket = m_Routes.Find(entry.m_Route);
+		assert(bucket != m_Routes.end());
+
+		Vector<EventSubscriber*>& subscribers = bucket->second;
+		assert(entry.m_Index < subscribers.Size());
+
+		EventSubscriber* last = subscribers.Back();
+		subscribers.PopBack();
+
+		if (entry.m_Index < subscribers.Size())
+		{
+			subscribers[entry.m_Index] = last;
+			m_Entries.At(last).m_Index = entry.m_Index;
+		}
+
+		if (subscribers.IsEmpty())
+		{
+			m_Routes.Remove(entry.m_Route);
+		}
+	}
+
+	void EventDispatchTable::Reroute()
+	{
+		std::uint64_t version = EventSubscriber::RouteVersion();
+		if (version == m_RouteVersion)
+		{
+			return;
+		}
+		m_RouteVersion = version;
+
+		for (auto& pair : m_Entries)
+		{
+			EventSubscriber* subscriber = const_cast<EventSubscriber*>(pair.first);
+			Key route = subscriber->RouteKey();
+			if (route != pair.second.m_Route)
+			{
+				Erase(pair.second);
+
+				Vector<EventSubscriber*>& bucket = m_Routes[route];
+				pair.second = Entry{ route, bucket.Size() };
+				bucket.PushBack(subscriber);
+			}
+		}
+	}
+
+	void EventDispatchTable::ApplyPending()
+	{
+		if (m_HasHoles)
+		{
+			Vector<Key> emptied;
+
+			for (auto& route : m_Routes)
+			{
+				Vector<EventSubscriber*>& bucket = route.second;
+				size_t live = 0;
+
+				for (size_t i = 0; i < bucket.Size(); ++i)
+				{
+					if (bucket[i] != nullptr)
+					{
+						m_Entries.At(bucket[i]).m_Index = live;
+						bucket[live++] = bucket[i];
+					}
+				}
+
+				while (bucket.Size() > live)
+				{
+					bucket.PopBack();
+				}
+
+				if (bucket.IsEmpty())
+				{
+					emptied.PushBack(route.first);
+				}
+			}
+
+			for (const Key& route : emptied)
+			{
+				m_Routes.Remove(route);
+			}
+
+			m_HasHoles = false;
+		}
+
+		Vector<EventSubscriber*> pending = std::move(m_PendingAdds);
+
+		for (EventSubscriber* subscriber : pending)
+		{
+			Add(*subscriber);
+		}
+	}
+
+	void EventDispatchTable::Notify(const Vector<EventSubscriber*>& bucket, const EventPublisher& event)
+	{
+		for (size_t i = 0; i < bucket.Size(); ++i)
+		{
+			if (bucket[i] != nullptr)
+			{
+				bucket[i]->Notify(event);
+			}
+		}
+	}
+
+	void EventDispatchTable::Notify(const Vector<EventSubscriber*>& bucket, const Vector<const EventPublisher*>& events)
+	{
+		for (size_t i = 0; i < bucket.Size(); ++i)
+		{
+			if (bucket[i] != nullptr)
+			{
+				bucket[i]->NotifyBatch(events);
+			}
+		}
+	}
+}
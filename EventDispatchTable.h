@@ -0,0 +1,185 @@
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include "EventSubscriber.h"
+#include "FlatHashMap.h"
+#include "Key.h"
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	class EventPublisher;
+
+	/// <summary>
+	/// EventDispatchTable class
+	/// the subscribers to one type of event, bucketed by the route key each of them listens on
+	/// an event is only handed to the subscribers with a null route and the ones on the event's own route,
+	/// so a subscriber never gets probed with events it would just ignore
+	/// subscribers can be added and removed from inside a notify, removals take effect right away and additions once the
+	/// outermost delivery is done
+	/// safe to use from any number of threads at once, every call takes the table's lock, so subscribers made on worker
+	/// threads can subscribe while another thread delivers, a delivery holds the lock until it is done
+	/// </summary>
+	class EventDispatchTable final
+	{
+	public:
+		/// <summary>
+		/// defaulted constructor for the dispatch table
+		/// </summary>
+		EventDispatchTable() = default;
+
+		/// <summary>
+		/// deleted copy constructor, events hold onto their table by pointer
+		/// </summary>
+		EventDispatchTable(const EventDispatchTable&) = delete;
+
+		/// <summary>
+		/// deleted copy assignment operator
+		/// </summary>
+		EventDispatchTable& operator=(const EventDispatchTable&) = delete;
+
+		/// <summary>
+		/// adds a subscriber, bucketed under its current route key
+		/// adding one that is already in the table does nothing
+		/// during a delivery it is held back until the delivery is done, so it won't hear the events being delivered
+		/// </summary>
+		/// <param name="subscriber">the subscriber to add</param>
+		void Add(EventSubscriber& subscriber);
+
+		/// <summary>
+		/// removes a subscriber in constant time, it won't be notified again even if a delivery is in progress
+		/// removing one that isn't in the table does nothing
+		/// </summary>
+		/// <param name="subscriber">the subscriber to remove</param>
+		void Remove(EventSubscriber& subscriber);
+
+		/// <summary>
+		/// removes every subscriber, and frees the memory unless a delivery is in progress
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// returns the number of subscribers, including any waiting to be added
+		/// </summary>
+		/// <returns>the number of subscribers</returns>
+		size_t Size() const;
+
+		/// <summary>
+		/// notifies the subscribers that want the given event
+		/// rebuckets any subscriber whose route changed first, if RoutesChanged was called since the last delivery
+		/// </summary>
+		/// <param name="event">the event to deliver</param>
+		void Deliver(const EventPublisher& event);
+
+		/// <summary>
+		/// groups the events by route and hands each subscriber all of the ones it wants in a single call
+		/// the events keep their relative order within each group
+		/// </summary>
+		/// <param name="events">the events to deliver, all of which use this table</param>
+		void Deliver(const Vector<const EventPublisher*>& events);
+
+	private:
+		/// <summary>
+		/// where a subscriber is bucketed
+		/// </summary>
+		struct Entry final
+		{
+			/// <summary>
+			/// the route it is bucketed under
+			/// </summary>
+			Key m_Route;
+
+			/// <summary>
+			/// its index in that route's bucket, which is its handle for removing it without a search
+			/// </summary>
+			size_t m_Index;
+		};
+
+		/// <summary>
+		/// counts a delivery in progress for as long as it is alive, and applies the held back changes when the outermost one ends
+		/// </summary>
+		class DeliveryScope final
+		{
+		public:
+			DeliveryScope(EventDispatchTable& table);
+			~DeliveryScope();
+
+		private:
+			EventDispatchTable& m_Table;
+		};
+
+		/// <summary>
+		/// puts a subscriber in the bucket for the given route
+		/// </summary>
+		/// <param name="subscriber">the subscriber to bucket</param>
+		/// <param name="route">the route to bucket it under</param>
+		void Insert(EventSubscriber& subscriber, const Key& route);
+
+		/// <summary>
+		/// takes a subscriber out of its bucket by swapping the last one in the bucket into its place
+		/// </summary>
+		/// <param name="entry">where the subscriber is bucketed</param>
+		void Erase(const Entry& entry);
+
+		/// <summary>
+		/// moves any subscriber whose route key changed since it was bucketed into its new bucket
+		/// only does anything when the route version changed since the last time, see EventSubscriber::RoutesChanged
+		/// </summary>
+		void Reroute();
+
+		/// <summary>
+		/// drops the holes left by removals during a delivery, then adds the subscribers that were held back
+		/// </summary>
+		void ApplyPending();
+
+		/// <summary>
+		/// notifies every live subscriber in a bucket with the event
+		/// </summary>
+		/// <param name="bucket">the bucket to notify</param>
+		/// <param name="event">the event to deliver</param>
+		static void Notify(const Vector<EventSubscriber*>& bucket, const EventPublisher& event);
+
+		/// <summary>
+		/// notifies every live subscriber in a bucket with the batch of events
+		/// </summary>
+		/// <param name="bucket">the bucket to notify</param>
+		/// <param name="events">the events to deliver</param>
+		static void Notify(const Vector<EventSubscriber*>& bucket, const Vector<const EventPublisher*>& events);
+
+		/// <summary>
+		/// where each subscriber is bucketed, looked up by the subscriber
+		/// </summary>
+		FlatHashMap<const EventSubscriber*, Entry> m_Entries;
+
+		/// <summary>
+		/// the subscribers bucketed by route, the null key holds the ones that want every event
+		/// a subscriber removed during a delivery leaves a nullptr behind until the delivery is done
+		/// </summary>
+		FlatHashMap<const Key, Vector<EventSubscriber*>> m_Routes;
+
+		/// <summary>
+		/// the subscribers added during a delivery, in the order they were added
+		/// </summary>
+		Vector<EventSubscriber*> m_PendingAdds;
+
+		/// <summary>
+		/// how many deliveries are in progress, more than one when a notify delivers another event
+		/// </summary>
+		size_t m_DeliveryDepth = 0;
+
+		/// <summary>
+		/// whether or not a removal during a delivery left a nullptr behind in a bucket
+		/// </summary>
+		bool m_HasHoles = false;
+
+		/// <summary>
+		/// the route version the subscribers' route keys were last checked at
+		/// </summary>
+		std::uint64_t m_RouteVersion = EventSubscriber::RouteVersion();
+
+		/// <summary>
+		/// guards everything above, recursive so a notify can add and remove subscribers on the delivering thread
+		/// </summary>
+		mutable std::recursive_mutex m_Mutex;
+	};
+}
@@ -23,22 +23,39 @@ namespace FieaGameEngine
 
 	const std::string& EventMessageAttributed::GetSubtype() const
 	{
-		return m_Subtype;
+		return GetPrescribed<s_SubtypeSlot>().Get<std::string>();
 	}
 
 	void EventMessageAttributed::SetSubtype(const std::string& subtype)
 	{
-		m_Subtype = subtype;
+		GetPrescribed<s_SubtypeSlot>() = subtype;
+	}
+
+	Key EventMessageAttributed::GetSubtypeKey() const
+	{
+		//a subtype that was never interned can't be found, but it can be interned later, so keep looking it up until it is
+		const std::string& subtype = GetSubtype();
+		if (m_SubtypeKey.IsNull() || m_SubtypeKey.Name() != subtype)
+		{
+			m_SubtypeKey = Key::Find(subtype);
+		}
+
+		return m_SubtypeKey;
 	}
 
 	WorldState* EventMessageAttributed::GetWorldState() const
 	{
-		return m_WorldState;
+		//worldstate isn't an rtti, the datum only holds the pointer for it
+		return reinterpret_cast<WorldState*>(GetPrescribed<s_WorldStateSlot>().Get<RTTI*>());
 	}
 
 	void EventMessageAttributed::SetWorldState(WorldState& worldState)
 	{
-		m_WorldState = &worldState;
+		GetPrescribed<s_WorldStateSlot>() = reinterpret_cast<RTTI*>(&worldState);
 	}
 
+	Key EventRoute<EventMessageAttributed>::Of(const EventMessageAttributed& message)
+	{
+		return message.GetSubtypeKey();
+	}
 }
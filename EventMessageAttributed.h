@@ -1,5 +1,6 @@
 #pragma once
 #include "Attributed.h"
+#include "Event.h"
 #include "WorldState.h"
 #include <string>
 #include "Signature.h"
@@ -65,6 +66,12 @@ namespace FieaGameEngine
 		/// <param name="subtype">the subtype to set</param>
 		void SetSubtype(const std::string& subtype);
 
+		/// <summary>
+		/// gets the interned key of the subtype, only looked up again when the subtype changes
+		/// </summary>
+		/// <returns>the key of the subtype, a null key if nothing has ever interned it</returns>
+		Key GetSubtypeKey() const;
+
 		/// <summary>
 		/// gets the worldstate associated with this message
 		/// </summary>
@@ -83,16 +90,47 @@ namespace FieaGameEngine
 		/// <returns>the vector of the signatures</returns>
 		static const Vector<Signature> Signatures();
 
+		/// <summary>
+		/// the slot of m_Subtype, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_SubtypeSlot = 1;
+
+		/// <summary>
+		/// the slot of m_WorldState, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_WorldStateSlot = 2;
+
 	protected:
 		/// <summary>
 		/// the subtype of this message
+		/// only read through its datum, since it isn't used when the type is stored in columns
 		/// </summary>
 		std::string m_Subtype;
 
 		/// <summary>
 		/// the worldstate associated with this message
+		/// only read through its datum, since it isn't used when the type is stored in columns
+		/// </summary>
+		WorldState* m_WorldState = nullptr;
+
+		/// <summary>
+		/// the key of the subtype as of the last time it was looked up
+		/// </summary>
+		mutable Key m_SubtypeKey;
+	};
+
+	/// <summary>
+	/// routes Event<EventMessageAttributed> by the message's subtype
+	/// </summary>
+	template <>
+	struct EventRoute<EventMessageAttributed> final
+	{
+		/// <summary>
+		/// returns the interned key of the message's subtype, a null key if nothing has ever listened for that subtype
 		/// </summary>
-		WorldState* m_WorldState;
+		/// <param name="message">the message being routed</param>
+		/// <returns>the route key of the message</returns>
+		static Key Of(const EventMessageAttributed& message);
 	};
 }
 
@@ -0,0 +1,90 @@
+#pragma once
+#include <memory>
+#include <mutex>
+#include "Event.h"
+#include "NodeAllocator.h"
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// EventPool class
+	/// hands out Event<T>s that go back into the pool instead of being deleted once the last shared_ptr to them is gone
+	/// the shared_ptr control blocks come from the pooled node allocator, so firing a pooled event doesn't touch the heap
+	/// safe to use from any number of threads at once
+	/// </summary>
+	/// <typeparam name="T">the message type of the events</typeparam>
+	template <typename T>
+	class EventPool final
+	{
+	public:
+		/// <summary>
+		/// how many free events the pool holds onto, any more than that are deleted
+		/// </summary>
+		static constexpr size_t s_MaxPooledCount = 1024;
+
+		/// <summary>
+		/// returns a recycled event, or a new one with a default constructed message if the pool is empty
+		/// a recycled event's message still holds whatever the last one put in it, so fill it in before queueing it
+		/// </summary>
+		/// <returns>the event</returns>
+		static std::shared_ptr<Event<T>> Acquire();
+
+		/// <summary>
+		/// returns a recycled event with the message moved into it, or a new one if the pool is empty
+		/// </summary>
+		/// <param name="message">the message to move into the event</param>
+		/// <returns>the event</returns>
+		static std::shared_ptr<Event<T>> Acquire(T&& message);
+
+		/// <summary>
+		/// returns the number of free events in the pool
+		/// </summary>
+		/// <returns>the number of free events</returns>
+		static size_t PooledCount();
+
+		/// <summary>
+		/// deletes every free event in the pool
+		/// </summary>
+		static void Trim();
+
+	private:
+		/// <summary>
+		/// the free events, and the lock that guards them
+		/// </summary>
+		struct Pool final
+		{
+			std::mutex m_Mutex;
+			Vector<Event<T>*> m_Free;
+		};
+
+		/// <summary>
+		/// the shared_ptr deleter, puts the event back in the pool
+		/// </summary>
+		struct Recycler final
+		{
+			void operator()(Event<T>* event) const;
+		};
+
+		/// <summary>
+		/// returns the pool, never destroyed so events released by statics in other translation units still have somewhere to go
+		/// </summary>
+		/// <returns>the pool</returns>
+		static Pool& GetPool();
+
+		/// <summary>
+		/// takes a free event out of the pool
+		/// </summary>
+		/// <returns>the event, nullptr if the pool is empty</returns>
+		static Event<T>* TakeFree();
+
+		/// <summary>
+		/// wraps an event in a shared_ptr that recycles it
+		/// </summary>
+		/// <param name="event">the event to wrap</param>
+		/// <returns>the shared_ptr</returns>
+		static std::shared_ptr<Event<T>> Wrap(Event<T>* event);
+	};
+}
+
+#include "EventPool.inl"
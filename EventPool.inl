@@ -0,0 +1,118 @@
+#include "pch.h"
+#include "EventPool.h"
+
+namespace FieaGameEngine
+{
+#pragma region EventPool
+	//Acquire
+	template<typename T>
+	inline std::shared_ptr<Event<T>> EventPool<T>::Acquire()
+	{
+		Event<T>* event = TakeFree();
+
+		if (event == nullptr)
+		{
+			event = new Event<T>(T());
+		}
+
+		return Wrap(event);
+	}
+
+	//Acquire
+	template<typename T>
+	inline std::shared_ptr<Event<T>> EventPool<T>::Acquire(T&& message)
+	{
+		Event<T>* event = TakeFree();
+
+		if (event == nullptr)
+		{
+			event = new Event<T>(std::move(message));
+		}
+		else
+		{
+			event->Message() = std::move(message);
+		}
+
+		return Wrap(event);
+	}
+
+	//PooledCount
+	template<typename T>
+	inline size_t EventPool<T>::PooledCount()
+	{
+		Pool& pool = GetPool();
+		std::lock_guard<std::mutex> lock(pool.m_Mutex);
+		return pool.m_Free.Size();
+	}
+
+	//Trim
+	template<typename T>
+	inline void EventPool<T>::Trim()
+	{
+		Vector<Event<T>*> free;
+
+		{
+			Pool& pool = GetPool();
+			std::lock_guard<std::mutex> lock(pool.m_Mutex);
+			free = std::move(pool.m_Free);
+		}
+
+		for (Event<T>* event : free)
+		{
+			delete event;
+		}
+	}
+
+	//GetPool
+	template<typename T>
+	inline typename EventPool<T>::Pool& EventPool<T>::GetPool()
+	{
+		static Pool* pool = new Pool();
+		return *pool;
+	}
+
+	//TakeFree
+	template<typename T>
+	inline Event<T>* EventPool<T>::TakeFree()
+	{
+		Pool& pool = GetPool();
+		std::lock_guard<std::mutex> lock(pool.m_Mutex);
+
+		if (pool.m_Free.IsEmpty())
+		{
+			return nullptr;
+		}
+
+		Event<T>* event = pool.m_Free.Back();
+		pool.m_Free.PopBack();
+		return event;
+	}
+
+	//Wrap
+	template<typename T>
+	inline std::shared_ptr<Event<T>> EventPool<T>::Wrap(Event<T>* event)
+	{
+		return std::shared_ptr<Event<T>>(event, Recycler(), NodeStdAllocator<Event<T>>());
+	}
+#pragma endregion EventPool
+
+#pragma region Recycler
+	//operator()
+	template<typename T>
+	inline void EventPool<T>::Recycler::operator()(Event<T>* event) const
+	{
+		{
+			Pool& pool = GetPool();
+			std::lock_guard<std::mutex> lock(pool.m_Mutex);
+
+			if (pool.m_Free.Size() < s_MaxPooledCount)
+			{
+				pool.m_Free.PushBack(event);
+				return;
+			}
+		}
+
+		delete event;
+	}
+#pragma endregion Recycler
+}
@@ -1,20 +1,49 @@
 #include "pch.h"
 #include "EventPublisher.h"
-#include "EventSubscriber.h"
+#include "EventDispatchTable.h"
 
 namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(EventPublisher);
 
-	EventPublisher::EventPublisher(const Vector<EventSubscriber*>& subscribers) : 
+	EventPublisher::EventPublisher(EventDispatchTable& subscribers) : 
 		m_Subscribers(&subscribers) {};
 
 	void EventPublisher::Deliver() const
 	{
-		for (EventSubscriber* subscriber : *m_Subscribers)
+		m_Subscribers->Deliver(*this);
+	}
+
+	void EventPublisher::Deliver(const Vector<const EventPublisher*>& events)
+	{
+		Vector<std::pair<EventDispatchTable*, Vector<const EventPublisher*>>> batches;
+
+		for (const EventPublisher* event : events)
 		{
-			assert(subscriber != nullptr);
-			subscriber->Notify(*this);
+			assert(event != nullptr);
+
+			auto batch = batches.begin();
+			while (batch != batches.end() && (*batch).first != event->m_Subscribers)
+			{
+				++batch;
+			}
+
+			if (batch == batches.end())
+			{
+				batch = batches.EmplaceBack(event->m_Subscribers, Vector<const EventPublisher*>());
+			}
+
+			(*batch).second.PushBack(event);
 		}
+
+		for (auto& batch : batches)
+		{
+			batch.first->Deliver(batch.second);
+		}
+	}
+
+	Key EventPublisher::RouteKey() const
+	{
+		return Key();
 	}
-}
\ No newline at end of file
+}
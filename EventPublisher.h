@@ -1,10 +1,11 @@
 #pragma once
 #include "RTTI.h"
+#include "Key.h"
 #include "Vector.h"
 
 namespace FieaGameEngine
 {
-	class EventSubscriber;
+	class EventDispatchTable;
 
 	/// <summary>
 	/// EventPublisher class
@@ -42,22 +43,36 @@ namespace FieaGameEngine
 		EventPublisher& operator=(EventPublisher&&) = default;
 
 		/// <summary>
-		/// iterates through the list of subscribers and calls their notify methods
+		/// notifies the subscribers that want this event
 		/// </summary>
 		void Deliver() const;
 
+		/// <summary>
+		/// delivers a batch of events, each subscriber is notified once with all of the events it wants
+		/// events of different types are split up by type, and keep their relative order within each type
+		/// </summary>
+		/// <param name="events">the events to deliver</param>
+		static void Deliver(const Vector<const EventPublisher*>& events);
+
+		/// <summary>
+		/// the route key of this event, only subscribers listening on this key (or on every key) are notified
+		/// a null key, the default, means the event only goes to the subscribers that want everything
+		/// </summary>
+		/// <returns>the route key of this event</returns>
+		virtual Key RouteKey() const;
+
 	protected:
 		/// <summary>
 		/// event publisher constructor
-		/// takes in a list of subscribers and saves the pointer to it
+		/// takes in the table of subscribers and saves the pointer to it
 		/// </summary>
 		/// <param name="subscribers">the subscribers to save</param>
-		EventPublisher(const Vector<EventSubscriber*>& subscribers);
+		EventPublisher(EventDispatchTable& subscribers);
 
 		/// <summary>
-		/// a pointer to the list of subscribers to iterate through
+		/// a pointer to the table of subscribers to deliver to
 		/// </summary>
-		const Vector<EventSubscriber*>* m_Subscribers;
+		EventDispatchTable* m_Subscribers;
 	};
 }
 
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "EventQueue.h"
+#include "NodeAllocator.h"
 #include <algorithm>
 
 namespace FieaGameEngine
@@ -8,52 +9,134 @@ namespace FieaGameEngine
 
 	EventQueue::EventQueue(GameTime& gameTime) : m_GameTime(gameTime) {}
 
-	void EventQueue::Enqueue(const std::shared_ptr<EventPublisher>& publisher, std::chrono::milliseconds delay)
+	EventQueue::~EventQueue()
 	{
-		QueueEntry entry
+		StagedEntry* staged = m_Staged.exchange(nullptr, std::memory_order_acquire);
+		while (staged != nullptr)
 		{
-			publisher,
-			m_GameTime.CurrentTime(),
-			delay
+			StagedEntry* next = staged->m_Next;
+			delete staged;
+			staged = next;
+		}
+	}
+
+	void EventQueue::Enqueue(std::shared_ptr<EventPublisher> publisher, std::chrono::milliseconds delay, size_t orderKey)
+	{
+		StagedEntry* staged = new StagedEntry
+		{
+			QueueEntry
+			{
+				std::move(publisher),
+				m_GameTime.CurrentTime() + delay,
+				orderKey,
+				m_NextSequence.fetch_add(1, std::memory_order_relaxed)
+			},
+			m_Staged.load(std::memory_order_relaxed)
 		};
 
-		m_EventQueue.PushBack(entry);
+		while (!m_Staged.compare_exchange_weak(staged->m_Next, staged, std::memory_order_release, std::memory_order_relaxed));
 	}
 
 	void EventQueue::Update()
 	{
-		auto expiredStart = std::partition(m_EventQueue.begin(), m_EventQueue.end(),
-			[this](QueueEntry queueEvent)
-			{
-				return !(queueEvent.IsExpired(m_GameTime.CurrentTime()));
-			});
+		Stage();
+
+		std::chrono::high_resolution_clock::time_point currentTime = m_GameTime.CurrentTime();
 
-		for (auto it = expiredStart; it != m_EventQueue.end(); ++it)
+		Vector<QueueEntry> expired;
+		while (!m_EventQueue.IsEmpty() && m_EventQueue.Front().IsExpired(currentTime))
 		{
-			(*it).m_Event->Deliver();
+			expired.PushBack(PopHeap());
 		}
 
-		m_EventQueue.Remove(expiredStart, m_EventQueue.end());
+		Vector<const EventPublisher*> events(expired.Size());
+		for (QueueEntry& entry : expired)
+		{
+			events.PushBack(entry.m_Event.get());
+		}
+
+		EventPublisher::Deliver(events);
 	}
 
 	size_t EventQueue::Size()
 	{
+		Stage();
 		return m_EventQueue.Size();
 	}
 
 	void EventQueue::Clear()
 	{
+		Stage();
 		m_EventQueue.Clear();
 	}
 
 	bool EventQueue::IsEmpty()
 	{
+		Stage();
 		return m_EventQueue.IsEmpty();
 	}
 
+	void EventQueue::Stage()
+	{
+		StagedEntry* staged = m_Staged.exchange(nullptr, std::memory_order_acquire);
+		while (staged != nullptr)
+		{
+			StagedEntry* next = staged->m_Next;
+			PushHeap(std::move(staged->m_Entry));
+			delete staged;
+			staged = next;
+		}
+	}
+
+	void EventQueue::PushHeap(QueueEntry&& entry)
+	{
+		m_EventQueue.PushBack(std::move(entry));
+
+		QueueEntry* first = &m_EventQueue.Front();
+		std::push_heap(first, first + m_EventQueue.Size(),
+			[](const QueueEntry& lhs, const QueueEntry& rhs)
+			{
+				return lhs.IsDueAfter(rhs);
+			});
+	}
+
+	EventQueue::QueueEntry EventQueue::PopHeap()
+	{
+		QueueEntry* first = &m_EventQueue.Front();
+		std::pop_heap(first, first + m_EventQueue.Size(),
+			[](const QueueEntry& lhs, const QueueEntry& rhs)
+			{
+				return lhs.IsDueAfter(rhs);
+			});
+
+		QueueEntry entry = std::move(m_EventQueue.Back());
+		m_EventQueue.PopBack();
+		return entry;
+	}
+
+	void* EventQueue::StagedEntry::operator new(size_t size)
+	{
+		return PooledNodeAllocator::Allocate(size);
+	}
+
+	void EventQueue::StagedEntry::operator delete(void* pointer, size_t size)
+	{
+		PooledNodeAllocator::Deallocate(pointer, size);
+	}
+
 	bool EventQueue::QueueEntry::IsExpired(std::chrono::high_resolution_clock::time_point currentTime) const
 	{
-		return ((m_TimeEnqueued + m_Delay) <= currentTime);
+		return (m_Expiry <= currentTime);
+	}
+
+	bool EventQueue::QueueEntry::IsDueAfter(const QueueEntry& other) const
+	{
+		if (m_Expiry != other.m_Expiry)
+		{
+			return (m_Expiry > other.m_Expiry);
+		}
+
+		return (m_OrderKey != other.m_OrderKey) ? (m_OrderKey > other.m_OrderKey) : (m_Sequence > other.m_Sequence);
 	}
 
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include "RTTI.h"
@@ -12,6 +13,7 @@ namespace FieaGameEngine
 	/// EventQueue class
 	/// Stores pointers to events and time information into a queue, and iterates through and checks whether or not said event needs to be delivered based on the gametime
 	/// Deliveres any events that need delivering
+	/// Enqueue can be called from any thread, everything else belongs to the thread that calls Update
 	/// </summary>
 	class EventQueue final : public RTTI
 	{
@@ -25,40 +27,44 @@ namespace FieaGameEngine
 		EventQueue(GameTime& gameTime);
 
 		/// <summary>
-		/// event queue default copy constructor
+		/// deleted copy constructor, other threads may be holding onto the queue
 		/// </summary>
-		EventQueue(const EventQueue&) = default;
+		EventQueue(const EventQueue&) = delete;
 
 		/// <summary>
-		/// event queue default move constructor
+		/// deleted move constructor
 		/// </summary>
-		EventQueue(EventQueue&&) = default;
+		EventQueue(EventQueue&&) = delete;
 
 		/// <summary>
-		/// event queue default destructor
+		/// event queue destructor
+		/// frees anything still waiting to be staged
 		/// </summary>
-		~EventQueue() = default;
+		~EventQueue();
 
 		/// <summary>
-		/// event queue default copy assignment operator
+		/// deleted copy assignment operator
 		/// </summary>
-		EventQueue& operator=(const EventQueue&) = default;
+		EventQueue& operator=(const EventQueue&) = delete;
 
 		/// <summary>
-		/// event queue default move assignment operator
+		/// deleted move assignment operator
 		/// </summary>
-		EventQueue& operator=(EventQueue&&) = default;
+		EventQueue& operator=(EventQueue&&) = delete;
 
 		/// <summary>
 		/// adds a new event to the queue, with its delay and the current time
+		/// safe to call from any number of threads at once, the event is pushed onto a lock free stack that Update drains
 		/// </summary>
-		/// <param name="publisher">the event to be queued</param>
+		/// <param name="publisher">the event to be queued, moved into the queue</param>
 		/// <param name="delay">the delay that that event should have before delivering</param>
-		void Enqueue(const std::shared_ptr<EventPublisher>& publisher, std::chrono::milliseconds delay = std::chrono::milliseconds(0));
+		/// <param name="orderKey">events that expire at the same time are delivered sorted by this, then by the order they were enqueued</param>
+		void Enqueue(std::shared_ptr<EventPublisher> publisher, std::chrono::milliseconds delay = std::chrono::milliseconds(0), size_t orderKey = 0);
 
 		/// <summary>
-		/// partitions the event queue based upon whether or not they are expired
-		/// calls deliver on the expired events, then removes them from the queue
+		/// pops the expired events off the front of the heap, then delivers them as one batch
+		/// events expire by time, then order key, then the order they were enqueued, and each subscriber gets them in that order
+		/// events enqueued while delivering wait for the next update
 		/// </summary>
 		void Update();
 
@@ -91,22 +97,83 @@ namespace FieaGameEngine
 			std::shared_ptr<EventPublisher> m_Event;
 
 			/// <summary>
-			/// the time that the event was enqueued 
+			/// the time the event was enqueued plus its delay
 			/// </summary>
-			std::chrono::high_resolution_clock::time_point m_TimeEnqueued;
+			std::chrono::high_resolution_clock::time_point m_Expiry;
 
 			/// <summary>
-			/// how long the event should be delayed
+			/// the order key passed to enqueue
 			/// </summary>
-			std::chrono::milliseconds m_Delay;
+			size_t m_OrderKey;
 
 			/// <summary>
-			/// compares the delay and the time enqueued to the current time and returns whether or not the former is greater than the latter (i.e. the event is expired)
+			/// when it was enqueued compared to every other entry
+			/// </summary>
+			size_t m_Sequence;
+
+			/// <summary>
+			/// returns whether or not the expiry time has passed (i.e. the event is expired)
 			/// </summary>
 			/// <param name="currentTime">the current time to be checked</param>
 			/// <returns>whether or not the event has expired</returns>
 			bool IsExpired(std::chrono::high_resolution_clock::time_point currentTime) const;
+
+			/// <summary>
+			/// returns whether or not this entry is due after the other one, by expiry, then order key, then sequence
+			/// used as the heap comparison so the soonest entry sits at the front
+			/// </summary>
+			/// <param name="other">the entry to compare against</param>
+			/// <returns>whether or not this entry is due after the other</returns>
+			bool IsDueAfter(const QueueEntry& other) const;
+		};
+
+		/// <summary>
+		/// an entry waiting on the lock free stack
+		/// </summary>
+		struct StagedEntry
+		{
+			/// <summary>
+			/// the entry itself
+			/// </summary>
+			QueueEntry m_Entry;
+
+			/// <summary>
+			/// the entry pushed before this one
+			/// </summary>
+			StagedEntry* m_Next;
+
+			/// <summary>
+			/// staged entries come from the pooled node allocator, so enqueueing doesn't go to the heap
+			/// </summary>
+			/// <param name="size">the size of the entry</param>
+			/// <returns>the memory for the entry</returns>
+			static void* operator new(size_t size);
+
+			/// <summary>
+			/// gives a staged entry's memory back to the pooled node allocator
+			/// </summary>
+			/// <param name="pointer">the memory to be freed</param>
+			/// <param name="size">the size of the entry</param>
+			static void operator delete(void* pointer, size_t size);
 		};
+
+		/// <summary>
+		/// moves everything on the lock free stack into the heap
+		/// </summary>
+		void Stage();
+
+		/// <summary>
+		/// adds an entry to the heap
+		/// </summary>
+		/// <param name="entry">the entry to be added</param>
+		void PushHeap(QueueEntry&& entry);
+
+		/// <summary>
+		/// removes the soonest entry from the heap and returns it
+		/// </summary>
+		/// <returns>the soonest entry</returns>
+		QueueEntry PopHeap();
+
 		/// <summary>
 		/// the game time to be used for updating
 		/// </summary>
@@ -114,8 +181,19 @@ namespace FieaGameEngine
 
 		/// <summary>
 		/// the queue of events to be delivered
+		/// kept as a binary min heap on expiry, so update only looks at the entries that are due
 		/// </summary>
 		Vector<QueueEntry> m_EventQueue;
+
+		/// <summary>
+		/// the top of the stack that Enqueue pushes onto
+		/// </summary>
+		std::atomic<StagedEntry*> m_Staged = nullptr;
+
+		/// <summary>
+		/// hands out the sequence of each enqueued entry
+		/// </summary>
+		std::atomic<size_t> m_NextSequence = 0;
 	};
 }
 
@@ -0,0 +1,31 @@
+#include "pch.h"
+#include "EventSubscriber.h"
+#include "Datum.h"
+
+namespace FieaGameEngine
+{
+	void EventSubscriber::NotifyBatch(const Vector<const EventPublisher*>& events)
+	{
+		for (const EventPublisher* event : events)
+		{
+			assert(event != nullptr);
+			Notify(*event);
+		}
+	}
+
+	Key EventSubscriber::RouteKey() const
+	{
+		return Key();
+	}
+
+	void EventSubscriber::RoutesChanged()
+	{
+		s_RouteVersion.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	std::uint64_t EventSubscriber::RouteVersion()
+	{
+		//both only ever go up, so their sum changes whenever either does
+		return s_RouteVersion.load(std::memory_order_relaxed) + Datum::WatchedWriteVersion();
+	}
+}
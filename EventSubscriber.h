@@ -1,5 +1,9 @@
 #pragma once
+#include <atomic>
+#include <cstdint>
 #include "EventPublisher.h"
+#include "Key.h"
+#include "Vector.h"
 
 namespace FieaGameEngine
 {
@@ -16,6 +20,40 @@ namespace FieaGameEngine
 		/// functionality is dependant upon the child implementation
 		/// </summary>
 		virtual void Notify(const EventPublisher&) = 0;
+
+		/// <summary>
+		/// notified once with every event of a batch that this subscriber wants, in the order they were queued
+		/// calls notify on each of them unless the child does something smarter
+		/// </summary>
+		/// <param name="events">the events that were delivered</param>
+		virtual void NotifyBatch(const Vector<const EventPublisher*>& events);
+
+		/// <summary>
+		/// the route key of the events this subscriber wants, read when it subscribes and again whenever the route version changes
+		/// a null key, the default, means every event of the type it subscribed to
+		/// </summary>
+		/// <returns>the route key this subscriber listens on</returns>
+		virtual Key RouteKey() const;
+
+		/// <summary>
+		/// tells every dispatch table that some subscriber's route key may have changed, so they check again before their next delivery
+		/// a subscriber whose route comes from its own state calls it whenever that state changes, one whose route comes from
+		/// an attribute can watch the attribute's datum instead, see Datum::Watch
+		/// </summary>
+		static void RoutesChanged();
+
+		/// <summary>
+		/// returns the route version, which changes whenever RoutesChanged is called or a watched datum is written
+		/// a dispatch table only checks its subscribers' route keys when this differs from the version it last checked at
+		/// </summary>
+		/// <returns>the current route version</returns>
+		static std::uint64_t RouteVersion();
+
+	private:
+		/// <summary>
+		/// the route version, shared by every subscriber
+		/// </summary>
+		inline static std::atomic<std::uint64_t> s_RouteVersion{ 0 };
 	};
 }
 
@@ -1,6 +1,8 @@
 #pragma once
+#include <mutex>
+#include <shared_mutex>
 #include <string>
-#include "HashMap.h"
+#include "FlatHashMap.h"
 
 namespace FieaGameEngine
 {
@@ -8,6 +10,7 @@ namespace FieaGameEngine
 	/// Factory class
 	/// Instantiates an object of a registered type
 	/// Keeps track of the currently existent factories
+	/// finding and creating can happen from any number of threads at once, even while factories are being added or removed
 	/// </summary>
 	template <typename T>
 	class Factory
@@ -55,8 +58,14 @@ namespace FieaGameEngine
 	private:
 		/// <summary>
 		/// hashmap of the "registered" factories
+		/// flat so lookups by class name stay a single probe no matter how many factories get registered
 		/// </summary>
-		static inline HashMap<const std::string, const Factory* const> s_FactoryMap;
+		static inline FlatHashMap<const std::string, const Factory* const> s_FactoryMap;
+
+		/// <summary>
+		/// guards the map of factories, shared by lookups and exclusive for adding and removing
+		/// </summary>
+		static inline std::shared_mutex s_FactoryMutex;
 	};
 
 	/// <summary>
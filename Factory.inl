@@ -6,6 +6,8 @@ namespace FieaGameEngine
 	template<typename T>
 	inline const Factory<T>* const Factory<T>::Find(const std::string& className)
 	{
+		std::shared_lock<std::shared_mutex> lock(s_FactoryMutex);
+
 		auto it = s_FactoryMap.Find(className);
 		return (it != s_FactoryMap.end()) ? it->second : nullptr;
 	}
@@ -20,6 +22,8 @@ namespace FieaGameEngine
 	template<typename T>
 	inline void Factory<T>::Add(const Factory<T>& factory)
 	{
+		std::unique_lock<std::shared_mutex> lock(s_FactoryMutex);
+
 		if (s_FactoryMap.ContainsKey(factory.ClassName()))
 		{
 			throw std::runtime_error("Factory is already registered");
@@ -31,6 +35,8 @@ namespace FieaGameEngine
 	template<typename T>
 	void Factory<T>::Remove(const Factory& factory)
 	{
+		std::unique_lock<std::shared_mutex> lock(s_FactoryMutex);
+
 		s_FactoryMap.Remove(factory.ClassName());
 	}
 }
\ No newline at end of file
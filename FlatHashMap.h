@@ -0,0 +1,642 @@
+#pragma once
+#include "DefaultEquality.h"
+#include "DefaultHash.h"
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// FlatHashMap class
+	/// open addressing (robin hood) version of HashMap, every pair lives inline in one contiguous slot array
+	/// grows automatically once the max load factor is passed, and moves the old slots over a few at a time on each insert
+	/// unlike HashMap, inserting or removing can move pairs around, so don't hold onto pointers or iterators across those calls
+	/// </summary>
+	/// <typeparam name="TKey">the data type for the keys</typeparam>
+	/// <typeparam name="TValue">the data type for the values</typeparam>
+	/// <typeparam name="HashFunctor">the functor to be used for hashing the keys</typeparam>
+	/// <typeparam name="EqualityFunctor">the functor to be used determining equality</typeparam>
+	template <typename TKey, typename TValue, typename HashFunctor = DefaultHash<TKey>, typename EqualityFunctor = DefaultEquality<TKey>>
+	class FlatHashMap
+	{
+		friend class Iterator;
+		friend class ConstIterator;
+
+	public:
+		using PairType = std::pair<const TKey, TValue>;
+
+	private:
+		/// <summary>
+		/// what actually gets constructed in a slot
+		/// same layout as PairType, but assignable so robin hood can swap pairs around
+		/// </summary>
+		using StorageType = std::pair<std::remove_const_t<TKey>, std::remove_const_t<TValue>>;
+
+		/// <summary>
+		/// one entry in the slot array
+		/// a distance of 0 means the slot is empty, otherwise it is how far the pair sits from its home slot plus one
+		/// </summary>
+		struct Slot final
+		{
+			size_t m_Hash;
+			std::uint32_t m_Distance;
+			alignas(StorageType) unsigned char m_Storage[sizeof(StorageType)];
+		};
+
+		/// <summary>
+		/// one slot array plus everything needed to index it
+		/// </summary>
+		struct Table final
+		{
+			Slot* m_Slots = nullptr;
+			size_t m_Capacity = 0;
+			size_t m_Shift = 0;
+			size_t m_Size = 0;
+		};
+
+	public:
+
+		/// <summary>
+		/// iterator class for flathashmap
+		/// allows for an outside user to iterate forward through the map
+		/// </summary>
+		class Iterator final
+		{
+			friend FlatHashMap;
+			friend class ConstIterator;
+
+		public:
+			/// <summary>
+			/// default constructor for Iterator
+			/// </summary>
+			Iterator() = default;
+
+			/// <summary>
+			/// default copy constructor for Iterator
+			/// </summary>
+			/// <param name="ToCopy">the iterator to be copied</param>
+			Iterator(const Iterator& ToCopy) = default;
+
+			/// <summary>
+			/// default move constructor for Iterator
+			/// </summary>
+			/// <param name="ToMove">the iterator to be moved</param>
+			Iterator(Iterator&& ToMove) noexcept = default;
+
+			/// <summary>
+			/// default copy assignment operator for Iterator
+			/// </summary>
+			/// <param name="ToCopy">the iterator to be copied</param>
+			/// <returns>the freshly copied iterator</returns>
+			Iterator& operator=(const Iterator& ToCopy) = default;
+
+			/// <summary>
+			/// default move assignment operator for Iterator
+			/// </summary>
+			/// <param name="ToMove">the iterator to be moved</param>
+			/// <returns>the iterator in its new location</returns>
+			Iterator& operator=(Iterator&& ToMove) noexcept = default;
+
+			/// <summary>
+			/// default destructor for Iterator
+			/// </summary>
+			~Iterator() = default;
+
+			/// <summary>
+			/// == operator for Iterator
+			/// </summary>
+			/// <param name="other">the iterator being compared</param>
+			/// <returns>whether or not the iterators being compared are equal</returns>
+			bool operator==(const Iterator& other) const;
+
+			/// <summary>
+			/// not equal operator for Iterator
+			/// </summary>
+			/// <param name="other">the iterator being compared</param>
+			/// <returns>whether or not the iterators being compared are not equal</returns>
+			bool operator!=(const Iterator& other) const;
+
+			/// <summary>
+			/// prefix incrementor for iterator
+			/// moves the iterator to the next occupied slot
+			/// </summary>
+			/// <returns>the iterator in its new location</returns>
+			/// <exception cref="std::runtime_error">throws an exception if the iterator has no owner</exception>
+			Iterator& operator++();
+
+			/// <summary>
+			/// postfix incrementor for iterator
+			/// moves the iterator to the next occupied slot
+			/// </summary>
+			/// <returns>the iterator before it was moved</returns>
+			Iterator operator++(int);
+
+			/// <summary>
+			/// dereference operator for iterator
+			/// </summary>
+			/// <returns>the pair being pointed to</returns>
+			/// <exception cref="std::runtime_error">throws exception if the iterator has no owner or is at the end</exception>
+			PairType& operator*() const;
+
+			/// <summary>
+			/// pointer dereference operator for iterator
+			/// </summary>
+			/// <returns>a pointer to the pair the iterator is looking at</returns>
+			PairType* operator->() const;
+
+		private:
+			/// <summary>
+			/// special iterator constructor that takes a slot index, and sets the owner
+			/// </summary>
+			/// <param name="owner">the map that owns the iterator</param>
+			/// <param name="index">the slot index the iterator is to point to</param>
+			Iterator(FlatHashMap& owner, size_t index);
+
+			/// <summary>
+			/// the owner of the iterator
+			/// </summary>
+			FlatHashMap* m_Owner = nullptr;
+
+			/// <summary>
+			/// the slot the iterator is pointing to, old table slots come before the current table's
+			/// </summary>
+			size_t m_Index = 0;
+		};
+
+		/// <summary>
+		/// ConstIterator class for flathashmap
+		/// allows for an outside user to iterate forward through a const map
+		/// </summary>
+		class ConstIterator final
+		{
+			friend FlatHashMap;
+
+		public:
+			/// <summary>
+			/// default constructor for ConstIterator
+			/// </summary>
+			ConstIterator() = default;
+
+			/// <summary>
+			/// constructor that constructs a const iterator from a regular iterator
+			/// </summary>
+			/// <param name="other">the iterator to make a ConstIterator with</param>
+			ConstIterator(const Iterator& other);
+
+			/// <summary>
+			/// default copy constructor for ConstIterator
+			/// </summary>
+			/// <param name="ToCopy">the ConstIterator to be copied</param>
+			ConstIterator(const ConstIterator& ToCopy) = default;
+
+			/// <summary>
+			/// default move constructor for ConstIterator
+			/// </summary>
+			/// <param name="ToMove">the ConstIterator to be moved</param>
+			ConstIterator(ConstIterator&& ToMove) noexcept = default;
+
+			/// <summary>
+			/// default copy assignment operator for ConstIterator
+			/// </summary>
+			/// <param name="ToCopy">the ConstIterator to be copied</param>
+			/// <returns>the freshly copied ConstIterator</returns>
+			ConstIterator& operator=(const ConstIterator& ToCopy) = default;
+
+			/// <summary>
+			/// default move assignment operator for ConstIterator
+			/// </summary>
+			/// <param name="ToMove">the ConstIterator to be moved</param>
+			/// <returns>the ConstIterator in its new location</returns>
+			ConstIterator& operator=(ConstIterator&& ToMove) noexcept = default;
+
+			/// <summary>
+			/// default destructor for ConstIterator
+			/// </summary>
+			~ConstIterator() = default;
+
+			/// <summary>
+			/// == operator for ConstIterator
+			/// </summary>
+			/// <param name="other">the ConstIterator being compared</param>
+			/// <returns>whether or not the ConstIterators being compared are equal</returns>
+			bool operator==(const ConstIterator& other) const;
+
+			/// <summary>
+			/// not equal operator for ConstIterator
+			/// </summary>
+			/// <param name="other">the ConstIterator being compared</param>
+			/// <returns>whether or not the ConstIterators being compared are not equal</returns>
+			bool operator!=(const ConstIterator& other) const;
+
+			/// <summary>
+			/// prefix incrementor for ConstIterator
+			/// moves the ConstIterator to the next occupied slot
+			/// </summary>
+			/// <returns>the ConstIterator in its new location</returns>
+			/// <exception cref="std::runtime_error">throws an exception if the ConstIterator has no owner</exception>
+			ConstIterator& operator++();
+
+			/// <summary>
+			/// postfix incrementor for ConstIterator
+			/// moves the ConstIterator to the next occupied slot
+			/// </summary>
+			/// <returns>the ConstIterator before it was moved</returns>
+			ConstIterator operator++(int);
+
+			/// <summary>
+			/// dereference operator for ConstIterator
+			/// </summary>
+			/// <returns>the pair being pointed to</returns>
+			/// <exception cref="std::runtime_error">throws exception if the ConstIterator has no owner or is at the end</exception>
+			const PairType& operator*() const;
+
+			/// <summary>
+			/// pointer dereference operator for ConstIterator
+			/// </summary>
+			/// <returns>a pointer to the pair the ConstIterator is looking at</returns>
+			const PairType* operator->() const;
+
+		private:
+			/// <summary>
+			/// special ConstIterator constructor that takes a slot index, and sets the owner
+			/// </summary>
+			/// <param name="owner">the map that owns the ConstIterator</param>
+			/// <param name="index">the slot index the ConstIterator is to point to</param>
+			ConstIterator(const FlatHashMap& owner, size_t index);
+
+			/// <summary>
+			/// the owner of the ConstIterator
+			/// </summary>
+			const FlatHashMap* m_Owner = nullptr;
+
+			/// <summary>
+			/// the slot the ConstIterator is pointing to, old table slots come before the current table's
+			/// </summary>
+			size_t m_Index = 0;
+		};
+
+		/// <summary>
+		/// constructor for flathashmap
+		/// </summary>
+		/// <param name="size">the starting number of slots, rounded up to a power of two</param>
+		/// <param name="maxLoadFactor">how full the slots can get before the map grows, between 0 and 1</param>
+		/// <exception cref="runtime_error">throws an exception if size is zero or the load factor is out of range</exception>
+		FlatHashMap(size_t size = 11, float maxLoadFactor = DefaultMaxLoadFactor);
+
+		/// <summary>
+		/// copy constructor for flathashmap
+		/// copies the slots as they are, including any rehash that is still in progress
+		/// </summary>
+		/// <param name="ToCopy">the map to be copied</param>
+		FlatHashMap(const FlatHashMap& ToCopy);
+
+		/// <summary>
+		/// move constructor for flathashmap
+		/// </summary>
+		/// <param name="ToMove">the map to be moved</param>
+		FlatHashMap(FlatHashMap&& ToMove) noexcept;
+
+		/// <summary>
+		/// copy assignment operator for flathashmap
+		/// </summary>
+		/// <param name="ToCopy">the map to be copied</param>
+		/// <returns>freshly copied map</returns>
+		FlatHashMap& operator=(const FlatHashMap& ToCopy);
+
+		/// <summary>
+		/// move assignment operator for flathashmap
+		/// </summary>
+		/// <param name="ToMove">the map to be moved</param>
+		/// <returns>the freshly moved map</returns>
+		FlatHashMap& operator=(FlatHashMap&& ToMove) noexcept;
+
+		/// <summary>
+		/// destructor for flathashmap
+		/// </summary>
+		~FlatHashMap();
+
+		/// <summary>
+		/// index operator for flathashmap
+		/// takes in a key and returns the associated value
+		/// if the key was not found, it creates a new pair with a default constructed TValue and returns that
+		/// </summary>
+		/// <param name="key">the key to be found</param>
+		/// <returns>the value associated with the key</returns>
+		TValue& operator[](const TKey& key);
+
+		/// <summary>
+		/// returns a value from a certain key
+		/// </summary>
+		/// <param name="key">the key to find the value at</param>
+		/// <returns>the given value</returns>
+		/// <exception cref="runtime_error">throws an exception if the key is not in the map</exception>
+		TValue& At(const TKey& key);
+
+		/// <summary>
+		/// const version of at
+		/// returns a value from a certain key
+		/// </summary>
+		/// <param name="key">the key to find the value at</param>
+		/// <returns>the given value</returns>
+		/// <exception cref="runtime_error">throws an exception if the key is not in the map</exception>
+		const TValue& At(const TKey& key) const;
+
+		/// <summary>
+		/// inserts a pair into the map
+		/// does nothing if the key is already there, grows the map if this insert would pass the max load factor
+		/// </summary>
+		/// <param name="pair">the pair to be inserted</param>
+		/// <returns>an iterator pointing at the pair with that key, and whether or not it was inserted</returns>
+		std::pair<Iterator, bool> Insert(const PairType& pair);
+
+		/// <summary>
+		/// move version of insert
+		/// inserts a pair into the map
+		/// does nothing if the key is already there, grows the map if this insert would pass the max load factor
+		/// </summary>
+		/// <param name="pair">the pair to be inserted</param>
+		/// <returns>an iterator pointing at the pair with that key, and whether or not it was inserted</returns>
+		std::pair<Iterator, bool> Insert(PairType&& pair);
+
+		/// <summary>
+		/// Finds the location of a pair based on its key
+		/// returns an iterator pointing at said key
+		/// </summary>
+		/// <param name="key">the key to be found</param>
+		/// <returns>an iterator pointing to the pair, or end if it is not in the map</returns>
+		Iterator Find(const TKey& key);
+
+		/// <summary>
+		/// const version of find
+		/// Finds the location of a pair based on its key
+		/// returns an iterator pointing at said key
+		/// </summary>
+		/// <param name="key">the key to be found</param>
+		/// <returns>a ConstIterator pointing to the pair, or end if it is not in the map</returns>
+		ConstIterator Find(const TKey& key) const;
+
+		/// <summary>
+		/// removes a pair based on its key
+		/// does nothing if it does not find the pair
+		/// </summary>
+		/// <param name="key">the key of the pair to be removed</param>
+		void Remove(const TKey& key);
+
+		/// <summary>
+		/// returns the number of pairs in the map
+		/// </summary>
+		/// <returns>the number of pairs in the map</returns>
+		size_t Size() const;
+
+		/// <summary>
+		/// returns the number of slots the map currently has
+		/// </summary>
+		/// <returns>the number of slots in the current table</returns>
+		size_t Capacity() const;
+
+		/// <summary>
+		/// checks whether or not the map contains a key
+		/// </summary>
+		/// <param name="key">the key to be found</param>
+		/// <returns>whether or not the key is in the map</returns>
+		bool ContainsKey(const TKey& key) const;
+
+		/// <summary>
+		/// grows the map so it can hold count pairs without passing the max load factor
+		/// finishes any rehash that is in progress
+		/// </summary>
+		/// <param name="count">the number of pairs to make room for</param>
+		void Reserve(size_t count);
+
+		/// <summary>
+		/// returns how full the map is
+		/// </summary>
+		/// <returns>the number of pairs divided by the number of slots</returns>
+		float LoadFactor() const;
+
+		/// <summary>
+		/// returns how full the map can get before it grows
+		/// </summary>
+		/// <returns>the max load factor</returns>
+		float MaxLoadFactor() const;
+
+		/// <summary>
+		/// changes how full the map can get before it grows
+		/// grows right away if the map is already past it
+		/// </summary>
+		/// <param name="maxLoadFactor">the new max load factor, between 0 and 1</param>
+		/// <exception cref="runtime_error">throws an exception if the load factor is out of range</exception>
+		void SetMaxLoadFactor(float maxLoadFactor);
+
+		/// <summary>
+		/// initializes an iterator at the first occupied slot
+		/// </summary>
+		/// <returns>the new iterator</returns>
+		Iterator begin();
+
+		/// <summary>
+		/// initializes an iterator past the end of the map
+		/// </summary>
+		/// <returns>the new iterator</returns>
+		Iterator end();
+
+		/// <summary>
+		/// initializes a ConstIterator at the first occupied slot
+		/// </summary>
+		/// <returns>the new iterator</returns>
+		ConstIterator begin() const;
+
+		/// <summary>
+		/// initializes a ConstIterator past the end of the map
+		/// </summary>
+		/// <returns>the new iterator</returns>
+		ConstIterator end() const;
+
+		/// <summary>
+		/// initializes a ConstIterator at the first occupied slot
+		/// </summary>
+		/// <returns>the new iterator</returns>
+		ConstIterator cbegin() const;
+
+		/// <summary>
+		/// initializes a ConstIterator past the end of the map
+		/// </summary>
+		/// <returns>the new iterator</returns>
+		ConstIterator cend() const;
+
+		/// <summary>
+		/// clears out the map
+		/// keeps the current number of slots
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// the max load factor a map gets if one isn't given
+		/// </summary>
+		static constexpr float DefaultMaxLoadFactor = 0.8f;
+
+	private:
+		/// <summary>
+		/// the smallest number of slots a table will have
+		/// </summary>
+		static constexpr size_t MinimumCapacity = 8;
+
+		/// <summary>
+		/// allocates an empty table with at least the given number of slots
+		/// </summary>
+		/// <param name="capacity">the number of slots wanted, rounded up to a power of two</param>
+		/// <returns>the new table</returns>
+		static Table MakeTable(size_t capacity);
+
+		/// <summary>
+		/// destroys every pair in a table and frees its slots
+		/// </summary>
+		/// <param name="table">the table to be destroyed</param>
+		static void DestroyTable(Table& table);
+
+		/// <summary>
+		/// copies every slot of one table into a fresh table of the same size
+		/// </summary>
+		/// <param name="table">the table to be copied</param>
+		/// <returns>the new table</returns>
+		static Table CopyTable(const Table& table);
+
+		/// <summary>
+		/// returns the slot a hash would like to live in
+		/// the hash gets mixed first so weak hashes (like the identity int hash) still spread out
+		/// </summary>
+		/// <param name="table">the table to be indexed</param>
+		/// <param name="hash">the hash of the key</param>
+		/// <returns>the home slot of the hash</returns>
+		static size_t HomeIndex(const Table& table, size_t hash);
+
+		/// <summary>
+		/// looks for a key in one table
+		/// </summary>
+		/// <param name="table">the table to be searched</param>
+		/// <param name="key">the key to be found</param>
+		/// <param name="hash">the hash of the key</param>
+		/// <returns>the slot the key is in, or the table's capacity if it is not there</returns>
+		size_t SearchTable(const Table& table, const TKey& key, size_t hash) const;
+
+		/// <summary>
+		/// places a pair into a table that is known not to contain its key
+		/// robin hood: whenever the pair is further from home than the one in the way, they swap and the other one keeps looking
+		/// </summary>
+		/// <param name="table">the table to insert into</param>
+		/// <param name="pair">the pair to be placed</param>
+		/// <param name="hash">the hash of the pair's key</param>
+		/// <returns>the slot the pair ended up in</returns>
+		template <typename PairArg>
+		static size_t PlaceInTable(Table& table, PairArg&& pair, size_t hash);
+
+		/// <summary>
+		/// removes the pair at a slot, shifting the following pairs back so no tombstones are needed
+		/// </summary>
+		/// <param name="table">the table to remove from</param>
+		/// <param name="index">the slot to be emptied</param>
+		static void EraseFromTable(Table& table, size_t index);
+
+		/// <summary>
+		/// shared insert logic for both versions of Insert
+		/// </summary>
+		/// <param name="pair">the pair to be inserted</param>
+		/// <returns>an iterator pointing at the pair with that key, and whether or not it was inserted</returns>
+		template <typename PairArg>
+		std::pair<Iterator, bool> InsertPair(PairArg&& pair);
+
+		/// <summary>
+		/// starts a rehash into a table with double the slots
+		/// finishes the previous rehash first if there is one
+		/// </summary>
+		/// <param name="capacity">the number of slots the new table should have at least</param>
+		void Grow(size_t capacity);
+
+		/// <summary>
+		/// moves up to count slots worth of pairs out of the old table and into the current one
+		/// </summary>
+		/// <param name="count">the number of old slots to walk</param>
+		void Migrate(size_t count);
+
+		/// <summary>
+		/// moves every pair left in the old table into the current one and frees the old table
+		/// </summary>
+		void FinishMigration();
+
+		/// <summary>
+		/// the number of old slots walked on each insert while a rehash is in progress
+		/// enough that the old table is always empty before the new one can fill up
+		/// </summary>
+		/// <returns>the number of slots to migrate per insert</returns>
+		size_t MigrationStep() const;
+
+		/// <summary>
+		/// returns whether or not one more pair would put the map past its max load factor
+		/// </summary>
+		/// <param name="count">the number of pairs the map would hold</param>
+		/// <returns>whether or not the current table is too small for count pairs</returns>
+		bool ExceedsLoad(size_t count) const;
+
+		/// <summary>
+		/// returns the slot at an iterator index, which can be in either table
+		/// </summary>
+		/// <param name="index">the iterator index</param>
+		/// <returns>the slot at that index</returns>
+		Slot& SlotAt(size_t index) const;
+
+		/// <summary>
+		/// returns the pair stored in a slot
+		/// </summary>
+		/// <param name="slot">the slot holding the pair</param>
+		/// <returns>the pair as the map hands it out, with a const key</returns>
+		static PairType& PairAt(Slot& slot);
+
+		/// <summary>
+		/// returns the pair stored in a slot, as the type it was constructed as
+		/// </summary>
+		/// <param name="slot">the slot holding the pair</param>
+		/// <returns>the assignable version of the pair</returns>
+		static StorageType& StorageAt(Slot& slot);
+
+		/// <summary>
+		/// finds the next occupied iterator index after the given one
+		/// </summary>
+		/// <param name="index">the iterator index to start after</param>
+		/// <returns>the next occupied index, or the end index</returns>
+		size_t FindNext(size_t index) const;
+
+		/// <summary>
+		/// the index of the end iterator
+		/// </summary>
+		/// <returns>the total number of slots in both tables</returns>
+		size_t EndIndex() const;
+
+		/// <summary>
+		/// the table new pairs go into
+		/// </summary>
+		Table m_Table;
+
+		/// <summary>
+		/// the table being drained by an incremental rehash, empty when no rehash is in progress
+		/// </summary>
+		Table m_OldTable;
+
+		/// <summary>
+		/// the next slot of the old table to be migrated
+		/// </summary>
+		size_t m_MigrateIndex = 0;
+
+		/// <summary>
+		/// how full the current table can get before the map grows
+		/// </summary>
+		float m_MaxLoadFactor = DefaultMaxLoadFactor;
+
+		/// <summary>
+		/// the equality functor to be used in the map
+		/// </summary>
+		EqualityFunctor m_EqualityFunctor;
+	};
+}
+
+#include "FlatHashMap.inl"
@@ -0,0 +1,821 @@
+#include "FlatHashMap.h"
+#include <new>
+
+namespace FieaGameEngine
+{
+#pragma region FlatHashMap
+
+	//constructor
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::FlatHashMap(size_t size, float maxLoadFactor) :
+		m_MaxLoadFactor(maxLoadFactor)
+	{
+		if (size == 0)
+		{
+			throw std::runtime_error("Size cannot be zero");
+		}
+
+		if (maxLoadFactor <= 0.0f || maxLoadFactor >= 1.0f)
+		{
+			throw std::runtime_error("Max load factor must be between 0 and 1");
+		}
+
+		m_Table = MakeTable(size);
+	}
+
+	//copy constructor
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::FlatHashMap(const FlatHashMap& ToCopy) :
+		m_Table(CopyTable(ToCopy.m_Table)), m_OldTable(CopyTable(ToCopy.m_OldTable)), m_MigrateIndex(ToCopy.m_MigrateIndex),
+		m_MaxLoadFactor(ToCopy.m_MaxLoadFactor), m_EqualityFunctor(ToCopy.m_EqualityFunctor) { }
+
+	//move constructor
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::FlatHashMap(FlatHashMap&& ToMove) noexcept :
+		m_Table(ToMove.m_Table), m_OldTable(ToMove.m_OldTable), m_MigrateIndex(ToMove.m_MigrateIndex),
+		m_MaxLoadFactor(ToMove.m_MaxLoadFactor), m_EqualityFunctor(std::move(ToMove.m_EqualityFunctor))
+	{
+		ToMove.m_Table = Table();
+		ToMove.m_OldTable = Table();
+		ToMove.m_MigrateIndex = 0;
+	}
+
+	//copy assignment
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>& FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::operator=(const FlatHashMap& ToCopy)
+	{
+		if (this != &ToCopy)
+		{
+			DestroyTable(m_Table);
+			DestroyTable(m_OldTable);
+
+			m_Table = CopyTable(ToCopy.m_Table);
+			m_OldTable = CopyTable(ToCopy.m_OldTable);
+			m_MigrateIndex = ToCopy.m_MigrateIndex;
+			m_MaxLoadFactor = ToCopy.m_MaxLoadFactor;
+			m_EqualityFunctor = ToCopy.m_EqualityFunctor;
+		}
+
+		return *this;
+	}
+
+	//move assignment
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>& FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::operator=(FlatHashMap&& ToMove) noexcept
+	{
+		if (this != &ToMove)
+		{
+			DestroyTable(m_Table);
+			DestroyTable(m_OldTable);
+
+			m_Table = ToMove.m_Table;
+			m_OldTable = ToMove.m_OldTable;
+			m_MigrateIndex = ToMove.m_MigrateIndex;
+			m_MaxLoadFactor = ToMove.m_MaxLoadFactor;
+			m_EqualityFunctor = std::move(ToMove.m_EqualityFunctor);
+
+			ToMove.m_Table = Table();
+			ToMove.m_OldTable = Table();
+			ToMove.m_MigrateIndex = 0;
+		}
+
+		return *this;
+	}
+
+	//destructor
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::~FlatHashMap()
+	{
+		DestroyTable(m_Table);
+		DestroyTable(m_OldTable);
+	}
+
+	//operator[]
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline TValue& FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::operator[](const TKey& key)
+	{
+		auto [it, inserted] = Insert(std::make_pair(key, TValue()));
+		return it->second;
+	}
+
+	//at
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline TValue& FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::At(const TKey& key)
+	{
+		Iterator it = Find(key);
+
+		if (it == end())
+		{
+			throw std::runtime_error("Key not in hash.");
+		}
+
+		return it->second;
+	}
+
+	//const at
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline const TValue& FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::At(const TKey& key) const
+	{
+		ConstIterator it = Find(key);
+
+		if (it == end())
+		{
+			throw std::runtime_error("Key not in hash.");
+		}
+
+		return it->second;
+	}
+
+	//insert
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline std::pair<typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator, bool> FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Insert(const PairType& pair)
+	{
+		return InsertPair(pair);
+	}
+
+	//move insert
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline std::pair<typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator, bool> FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Insert(PairType&& pair)
+	{
+		return InsertPair(std::move(pair));
+	}
+
+	//find
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Find(const TKey& key)
+	{
+		HashFunctor hash;
+		size_t hashed = hash(key);
+
+		size_t index = SearchTable(m_Table, key, hashed);
+		if (index != m_Table.m_Capacity)
+		{
+			return Iterator(*this, m_OldTable.m_Capacity + index);
+		}
+
+		index = SearchTable(m_OldTable, key, hashed);
+		if (index != m_OldTable.m_Capacity)
+		{
+			return Iterator(*this, index);
+		}
+
+		return end();
+	}
+
+	//const find
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Find(const TKey& key) const
+	{
+		HashFunctor hash;
+		size_t hashed = hash(key);
+
+		size_t index = SearchTable(m_Table, key, hashed);
+		if (index != m_Table.m_Capacity)
+		{
+			return ConstIterator(*this, m_OldTable.m_Capacity + index);
+		}
+
+		index = SearchTable(m_OldTable, key, hashed);
+		if (index != m_OldTable.m_Capacity)
+		{
+			return ConstIterator(*this, index);
+		}
+
+		return end();
+	}
+
+	//remove
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Remove(const TKey& key)
+	{
+		HashFunctor hash;
+		size_t hashed = hash(key);
+
+		size_t index = SearchTable(m_Table, key, hashed);
+		if (index != m_Table.m_Capacity)
+		{
+			EraseFromTable(m_Table, index);
+			return;
+		}
+
+		index = SearchTable(m_OldTable, key, hashed);
+		if (index != m_OldTable.m_Capacity)
+		{
+			EraseFromTable(m_OldTable, index);
+		}
+	}
+
+	//size
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline size_t FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Size() const
+	{
+		return m_Table.m_Size + m_OldTable.m_Size;
+	}
+
+	//capacity
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline size_t FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Capacity() const
+	{
+		return m_Table.m_Capacity;
+	}
+
+	//containsKey
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline bool FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ContainsKey(const TKey& key) const
+	{
+		return Find(key) != end();
+	}
+
+	//reserve
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Reserve(size_t count)
+	{
+		if (ExceedsLoad(count))
+		{
+			Grow(static_cast<size_t>(count / m_MaxLoadFactor) + 1);
+		}
+
+		FinishMigration();
+	}
+
+	//loadFactor
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline float FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::LoadFactor() const
+	{
+		return (m_Table.m_Capacity == 0) ? 0.0f : static_cast<float>(Size()) / static_cast<float>(m_Table.m_Capacity);
+	}
+
+	//maxLoadFactor
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline float FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::MaxLoadFactor() const
+	{
+		return m_MaxLoadFactor;
+	}
+
+	//setMaxLoadFactor
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::SetMaxLoadFactor(float maxLoadFactor)
+	{
+		if (maxLoadFactor <= 0.0f || maxLoadFactor >= 1.0f)
+		{
+			throw std::runtime_error("Max load factor must be between 0 and 1");
+		}
+
+		m_MaxLoadFactor = maxLoadFactor;
+		Reserve(Size());
+	}
+
+	//begin
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::begin()
+	{
+		return Iterator(*this, FindNext(0));
+	}
+
+	//end
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::end()
+	{
+		return Iterator(*this, EndIndex());
+	}
+
+	//const begin
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::begin() const
+	{
+		return ConstIterator(*this, FindNext(0));
+	}
+
+	//const end
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::end() const
+	{
+		return ConstIterator(*this, EndIndex());
+	}
+
+	//cbegin
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::cbegin() const
+	{
+		return begin();
+	}
+
+	//cend
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::cend() const
+	{
+		return end();
+	}
+
+	//clear
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Clear()
+	{
+		DestroyTable(m_OldTable);
+		m_MigrateIndex = 0;
+
+		for (size_t i = 0; i < m_Table.m_Capacity; ++i)
+		{
+			Slot& slot = m_Table.m_Slots[i];
+			if (slot.m_Distance != 0)
+			{
+				StorageAt(slot).~StorageType();
+				slot.m_Distance = 0;
+			}
+		}
+
+		m_Table.m_Size = 0;
+	}
+
+	//makeTable
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Table FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::MakeTable(size_t capacity)
+	{
+		Table table;
+		table.m_Capacity = MinimumCapacity;
+		table.m_Shift = 64 - 3;
+
+		while (table.m_Capacity < capacity)
+		{
+			table.m_Capacity <<= 1;
+			--table.m_Shift;
+		}
+
+		table.m_Slots = new Slot[table.m_Capacity]();
+		return table;
+	}
+
+	//destroyTable
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::DestroyTable(Table& table)
+	{
+		if (table.m_Slots != nullptr)
+		{
+			if constexpr (!std::is_trivially_destructible_v<StorageType>)
+			{
+				for (size_t i = 0; i < table.m_Capacity && table.m_Size > 0; ++i)
+				{
+					Slot& slot = table.m_Slots[i];
+					if (slot.m_Distance != 0)
+					{
+						StorageAt(slot).~StorageType();
+						--table.m_Size;
+					}
+				}
+			}
+
+			delete[] table.m_Slots;
+		}
+
+		table = Table();
+	}
+
+	//copyTable
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Table FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::CopyTable(const Table& table)
+	{
+		if (table.m_Slots == nullptr)
+		{
+			return Table();
+		}
+
+		Table copy = MakeTable(table.m_Capacity);
+
+		for (size_t i = 0; i < table.m_Capacity; ++i)
+		{
+			Slot& from = table.m_Slots[i];
+			if (from.m_Distance != 0)
+			{
+				Slot& to = copy.m_Slots[i];
+				new(to.m_Storage) StorageType(StorageAt(from));
+				to.m_Hash = from.m_Hash;
+				to.m_Distance = from.m_Distance;
+			}
+		}
+
+		copy.m_Size = table.m_Size;
+		return copy;
+	}
+
+	//homeIndex
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline size_t FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::HomeIndex(const Table& table, size_t hash)
+	{
+		const std::uint64_t goldenRatio = 0x9E3779B97F4A7C15ull;
+		return static_cast<size_t>((static_cast<std::uint64_t>(hash) * goldenRatio) >> table.m_Shift);
+	}
+
+	//searchTable
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline size_t FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::SearchTable(const Table& table, const TKey& key, size_t hash) const
+	{
+		if (table.m_Size == 0)
+		{
+			return table.m_Capacity;
+		}
+
+		const size_t mask = table.m_Capacity - 1;
+		size_t index = HomeIndex(table, hash);
+
+		for (std::uint32_t distance = 1; ; ++distance)
+		{
+			Slot& slot = table.m_Slots[index];
+
+			if (slot.m_Distance < distance)
+			{
+				return table.m_Capacity;
+			}
+
+			if (slot.m_Hash == hash && m_EqualityFunctor(key, PairAt(slot).first))
+			{
+				return index;
+			}
+
+			index = (index + 1) & mask;
+		}
+	}
+
+	//placeInTable
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	template <typename PairArg>
+	inline size_t FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::PlaceInTable(Table& table, PairArg&& pair, size_t hash)
+	{
+		const size_t mask = table.m_Capacity - 1;
+		size_t index = HomeIndex(table, hash);
+		std::uint32_t distance = 1;
+
+		for (;; index = (index + 1) & mask, ++distance)
+		{
+			Slot& slot = table.m_Slots[index];
+
+			if (slot.m_Distance == 0)
+			{
+				new(slot.m_Storage) StorageType(std::forward<PairArg>(pair));
+				slot.m_Hash = hash;
+				slot.m_Distance = distance;
+				++table.m_Size;
+				return index;
+			}
+
+			if (slot.m_Distance < distance)
+			{
+				break;
+			}
+		}
+
+		//the new pair steals this slot, the pair it displaced keeps probing
+		const size_t placedIndex = index;
+		Slot& placed = table.m_Slots[index];
+
+		StorageType displaced(std::move(StorageAt(placed)));
+		size_t displacedHash = placed.m_Hash;
+		std::uint32_t displacedDistance = placed.m_Distance;
+
+		StorageAt(placed).~StorageType();
+		new(placed.m_Storage) StorageType(std::forward<PairArg>(pair));
+		placed.m_Hash = hash;
+		placed.m_Distance = distance;
+
+		for (index = (index + 1) & mask, ++displacedDistance; ; index = (index + 1) & mask, ++displacedDistance)
+		{
+			Slot& slot = table.m_Slots[index];
+
+			if (slot.m_Distance == 0)
+			{
+				new(slot.m_Storage) StorageType(std::move(displaced));
+				slot.m_Hash = displacedHash;
+				slot.m_Distance = displacedDistance;
+				break;
+			}
+
+			if (slot.m_Distance < displacedDistance)
+			{
+				std::swap(displaced, StorageAt(slot));
+				std::swap(displacedHash, slot.m_Hash);
+				std::swap(displacedDistance, slot.m_Distance);
+			}
+		}
+
+		++table.m_Size;
+		return placedIndex;
+	}
+
+	//eraseFromTable
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::EraseFromTable(Table& table, size_t index)
+	{
+		const size_t mask = table.m_Capacity - 1;
+		StorageAt(table.m_Slots[index]).~StorageType();
+
+		for (size_t next = (index + 1) & mask; table.m_Slots[next].m_Distance > 1; index = next, next = (next + 1) & mask)
+		{
+			Slot& from = table.m_Slots[next];
+			Slot& to = table.m_Slots[index];
+
+			new(to.m_Storage) StorageType(std::move(StorageAt(from)));
+			StorageAt(from).~StorageType();
+			to.m_Hash = from.m_Hash;
+			to.m_Distance = from.m_Distance - 1;
+		}
+
+		table.m_Slots[index].m_Distance = 0;
+		--table.m_Size;
+	}
+
+	//insertPair
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	template <typename PairArg>
+	inline std::pair<typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator, bool> FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::InsertPair(PairArg&& pair)
+	{
+		HashFunctor hash;
+		size_t hashed = hash(pair.first);
+
+		size_t index = SearchTable(m_Table, pair.first, hashed);
+		if (index != m_Table.m_Capacity)
+		{
+			return std::make_pair(Iterator(*this, m_OldTable.m_Capacity + index), false);
+		}
+
+		index = SearchTable(m_OldTable, pair.first, hashed);
+		if (index != m_OldTable.m_Capacity)
+		{
+			return std::make_pair(Iterator(*this, index), false);
+		}
+
+		Migrate(MigrationStep());
+
+		if (ExceedsLoad(Size() + 1))
+		{
+			Grow(m_Table.m_Capacity * 2);
+		}
+
+		index = PlaceInTable(m_Table, std::forward<PairArg>(pair), hashed);
+		return std::make_pair(Iterator(*this, m_OldTable.m_Capacity + index), true);
+	}
+
+	//grow
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Grow(size_t capacity)
+	{
+		FinishMigration();
+
+		m_OldTable = m_Table;
+		m_Table = MakeTable(capacity);
+		m_MigrateIndex = 0;
+
+		if (m_OldTable.m_Size == 0)
+		{
+			DestroyTable(m_OldTable);
+		}
+	}
+
+	//migrate
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Migrate(size_t count)
+	{
+		while (m_OldTable.m_Slots != nullptr && count > 0)
+		{
+			if (m_OldTable.m_Size == 0 || m_MigrateIndex == m_OldTable.m_Capacity)
+			{
+				DestroyTable(m_OldTable);
+				m_MigrateIndex = 0;
+				break;
+			}
+
+			//erasing shifts the next pair back into this slot, so only move on once it is empty
+			Slot& slot = m_OldTable.m_Slots[m_MigrateIndex];
+			if (slot.m_Distance != 0)
+			{
+				PlaceInTable(m_Table, std::move(StorageAt(slot)), slot.m_Hash);
+				EraseFromTable(m_OldTable, m_MigrateIndex);
+			}
+			else
+			{
+				++m_MigrateIndex;
+			}
+
+			--count;
+		}
+	}
+
+	//finishMigration
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline void FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::FinishMigration()
+	{
+		//moving a pair doesn't move on to the next slot and freeing the table takes a step of its own,
+		//so one pass of capacity steps isn't always enough
+		while (m_OldTable.m_Slots != nullptr)
+		{
+			Migrate(m_OldTable.m_Capacity + 1);
+		}
+	}
+
+	//migrationStep
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline size_t FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::MigrationStep() const
+	{
+		return static_cast<size_t>(1.0f / m_MaxLoadFactor) + 1;
+	}
+
+	//exceedsLoad
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline bool FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ExceedsLoad(size_t count) const
+	{
+		return static_cast<float>(count) > static_cast<float>(m_Table.m_Capacity) * m_MaxLoadFactor;
+	}
+
+	//slotAt
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Slot& FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::SlotAt(size_t index) const
+	{
+		return (index < m_OldTable.m_Capacity) ? m_OldTable.m_Slots[index] : m_Table.m_Slots[index - m_OldTable.m_Capacity];
+	}
+
+	//pairAt
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::PairType& FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::PairAt(Slot& slot)
+	{
+		return *std::launder(reinterpret_cast<PairType*>(slot.m_Storage));
+	}
+
+	//storageAt
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::StorageType& FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::StorageAt(Slot& slot)
+	{
+		return *std::launder(reinterpret_cast<StorageType*>(slot.m_Storage));
+	}
+
+	//findNext
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline size_t FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::FindNext(size_t index) const
+	{
+		const size_t endIndex = EndIndex();
+
+		while (index < endIndex && SlotAt(index).m_Distance == 0)
+		{
+			++index;
+		}
+
+		return index;
+	}
+
+	//endIndex
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline size_t FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::EndIndex() const
+	{
+		return m_OldTable.m_Capacity + m_Table.m_Capacity;
+	}
+
+#pragma endregion FlatHashMap
+
+#pragma region Iterator
+
+	//iterator constructor
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator::Iterator(FlatHashMap& owner, size_t index) :
+		m_Owner(&owner), m_Index(index) { }
+
+	//operator==
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline bool FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator::operator==(const Iterator& other) const
+	{
+		return !(operator!=(other));
+	}
+
+	//operator!=
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline bool FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator::operator!=(const Iterator& other) const
+	{
+		return m_Owner != other.m_Owner || m_Index != other.m_Index;
+	}
+
+	//operator++
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator& FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator::operator++()
+	{
+		if (m_Owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated iterator");
+		}
+
+		if (m_Index < m_Owner->EndIndex())
+		{
+			m_Index = m_Owner->FindNext(m_Index + 1);
+		}
+
+		return *this;
+	}
+
+	//postfix operator++
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator::operator++(int)
+	{
+		Iterator temp = *this;
+		operator++();
+		return temp;
+	}
+
+	//operator*
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::PairType& FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator::operator*() const
+	{
+		if (m_Owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated Iterator");
+		}
+
+		if (m_Index >= m_Owner->EndIndex())
+		{
+			throw std::runtime_error("Null reference");
+		}
+
+		return PairAt(m_Owner->SlotAt(m_Index));
+	}
+
+	//operator->
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::PairType* FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::Iterator::operator->() const
+	{
+		return &(operator*());
+	}
+
+#pragma endregion Iterator
+
+#pragma region ConstIterator
+
+	//constiterator constructor
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::ConstIterator(const FlatHashMap& owner, size_t index) :
+		m_Owner(&owner), m_Index(index) { }
+
+	//constiterator from other iterator
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::ConstIterator(const Iterator& other) :
+		m_Owner(other.m_Owner), m_Index(other.m_Index) { }
+
+	//operator==
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline bool FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::operator==(const ConstIterator& other) const
+	{
+		return !(operator!=(other));
+	}
+
+	//operator!=
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline bool FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::operator!=(const ConstIterator& other) const
+	{
+		return m_Owner != other.m_Owner || m_Index != other.m_Index;
+	}
+
+	//operator++
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator& FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::operator++()
+	{
+		if (m_Owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated ConstIterator");
+		}
+
+		if (m_Index < m_Owner->EndIndex())
+		{
+			m_Index = m_Owner->FindNext(m_Index + 1);
+		}
+
+		return *this;
+	}
+
+	//postfix operator++
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::operator++(int)
+	{
+		ConstIterator temp = *this;
+		operator++();
+		return temp;
+	}
+
+	//operator*
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline const typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::PairType& FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::operator*() const
+	{
+		if (m_Owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated ConstIterator");
+		}
+
+		if (m_Index >= m_Owner->EndIndex())
+		{
+			throw std::runtime_error("Null reference");
+		}
+
+		return PairAt(m_Owner->SlotAt(m_Index));
+	}
+
+	//operator->
+	template<typename TKey, typename TValue, typename HashFunctor, typename EqualityFunctor>
+	inline const typename FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::PairType* FlatHashMap<TKey, TValue, HashFunctor, EqualityFunctor>::ConstIterator::operator->() const
+	{
+		return &(operator*());
+	}
+
+#pragma endregion ConstIterator
+}
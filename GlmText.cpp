@@ -0,0 +1,143 @@
+#include "pch.h"
+#include "GlmText.h"
+#include <charconv>
+
+namespace FieaGameEngine
+{
+	glm::vec4 GlmText::ParseVector(std::string_view text)
+	{
+		glm::vec4 vector;
+
+		Expect(text, "vec4");
+		ReadComponents(text, vector);
+		Expect(text, "");
+
+		return vector;
+	}
+
+	glm::mat4 GlmText::ParseMatrix(std::string_view text)
+	{
+		glm::mat4 matrix;
+
+		if (!Accept(text, "mat4x4"))
+		{
+			Expect(text, "mat4");
+		}
+
+		Expect(text, "(");
+		for (int column = 0; column < 4; ++column)
+		{
+			if (column > 0)
+			{
+				Expect(text, ",");
+			}
+			ReadComponents(text, matrix[column]);
+		}
+		Expect(text, ")");
+		Expect(text, "");
+
+		return matrix;
+	}
+
+	std::string GlmText::ToString(const glm::vec4& vector)
+	{
+		std::string output;
+		output.reserve(64);
+
+		output.append("vec4");
+		WriteComponents(vector, output);
+
+		return output;
+	}
+
+	std::string GlmText::ToString(const glm::mat4& matrix)
+	{
+		std::string output;
+		output.reserve(256);
+
+		output.append("mat4(");
+		for (int column = 0; column < 4; ++column)
+		{
+			if (column > 0)
+			{
+				output.append(", ");
+			}
+			WriteComponents(matrix[column], output);
+		}
+		output.push_back(')');
+
+		return output;
+	}
+
+	void GlmText::ReadComponents(std::string_view& text, glm::vec4& vector)
+	{
+		Expect(text, "(");
+		for (int component = 0; component < 4; ++component)
+		{
+			if (component > 0)
+			{
+				Expect(text, ",");
+			}
+			vector[component] = ReadFloat(text);
+		}
+		Expect(text, ")");
+	}
+
+	float GlmText::ReadFloat(std::string_view& text)
+	{
+		Accept(text, "+");
+
+		float value;
+		auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+
+		if (error != std::errc())
+		{
+			throw std::runtime_error("Text is not a valid vector or matrix");
+		}
+
+		text.remove_prefix(static_cast<size_t>(end - text.data()));
+		return value;
+	}
+
+	bool GlmText::Accept(std::string_view& text, std::string_view expected)
+	{
+		size_t start = text.find_first_not_of(" \t\r\n");
+		text.remove_prefix((start != std::string_view::npos) ? start : text.size());
+
+		if (text.substr(0, expected.size()) != expected)
+		{
+			return false;
+		}
+
+		text.remove_prefix(expected.size());
+		return true;
+	}
+
+	void GlmText::Expect(std::string_view& text, std::string_view expected)
+	{
+		//expecting nothing means the text has to be finished
+		if (!Accept(text, expected) || (expected.empty() && !text.empty()))
+		{
+			throw std::runtime_error("Text is not a valid vector or matrix");
+		}
+	}
+
+	void GlmText::WriteComponents(const glm::vec4& vector, std::string& output)
+	{
+		char buffer[32];
+
+		output.push_back('(');
+		for (int component = 0; component < 4; ++component)
+		{
+			if (component > 0)
+			{
+				output.append(", ");
+			}
+
+			auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), vector[component]);
+			assert(error == std::errc());
+			output.append(buffer, end);
+		}
+		output.push_back(')');
+	}
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <glm/glm.hpp>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// GlmText class
+	/// reads and writes the text forms of vectors and matrices, vec4(x, y, z, w) and mat4((x, y, z, w), ...) with one
+	/// column per set of parentheses
+	/// numbers go through from_chars and to_chars, so nothing depends on the locale and nothing is built up through a stream,
+	/// and what gets written reads back to exactly the same floats
+	/// </summary>
+	class GlmText final
+	{
+	public:
+		/// <summary>
+		/// deleted constructor since the class is static
+		/// </summary>
+		GlmText() = delete;
+
+		/// <summary>
+		/// reads a vector from its text form
+		/// </summary>
+		/// <param name="text">the text to read, with any amount of whitespace between the parts</param>
+		/// <returns>the vector</returns>
+		/// <exception cref="runtime_error">throws an exception if the text isn't a vec4</exception>
+		static glm::vec4 ParseVector(std::string_view text);
+
+		/// <summary>
+		/// reads a matrix from its text form, mat4x4 is accepted in place of mat4 so glm's own output reads too
+		/// </summary>
+		/// <param name="text">the text to read, with any amount of whitespace between the parts</param>
+		/// <returns>the matrix</returns>
+		/// <exception cref="runtime_error">throws an exception if the text isn't a mat4</exception>
+		static glm::mat4 ParseMatrix(std::string_view text);
+
+		/// <summary>
+		/// writes a vector in its text form
+		/// </summary>
+		/// <param name="vector">the vector to write</param>
+		/// <returns>the text, with the shortest digits that read back to the same floats</returns>
+		static std::string ToString(const glm::vec4& vector);
+
+		/// <summary>
+		/// writes a matrix in its text form
+		/// </summary>
+		/// <param name="matrix">the matrix to write</param>
+		/// <returns>the text, with the shortest digits that read back to the same floats</returns>
+		static std::string ToString(const glm::mat4& matrix);
+
+	private:
+		/// <summary>
+		/// reads the four floats of a vector in parentheses
+		/// </summary>
+		/// <param name="text">the text to read from, moved past what was read</param>
+		/// <param name="vector">the vector to read into</param>
+		static void ReadComponents(std::string_view& text, glm::vec4& vector);
+
+		/// <summary>
+		/// reads a float, skipping whitespace before it
+		/// </summary>
+		/// <param name="text">the text to read from, moved past what was read</param>
+		/// <returns>the float</returns>
+		static float ReadFloat(std::string_view& text);
+
+		/// <summary>
+		/// skips whitespace, then reads the given text if it is next
+		/// </summary>
+		/// <param name="text">the text to read from, moved past what was read</param>
+		/// <param name="expected">the text that should come next</param>
+		/// <returns>whether or not the expected text was next</returns>
+		static bool Accept(std::string_view& text, std::string_view expected);
+
+		/// <summary>
+		/// reads the given text, which has to be next
+		/// </summary>
+		/// <param name="text">the text to read from, moved past what was read</param>
+		/// <param name="expected">the text that has to come next</param>
+		/// <exception cref="runtime_error">throws an exception if the expected text isn't next</exception>
+		static void Expect(std::string_view& text, std::string_view expected);
+
+		/// <summary>
+		/// writes the four floats of a vector in parentheses
+		/// </summary>
+		/// <param name="vector">the vector to write</param>
+		/// <param name="output">the string to append to</param>
+		static void WriteComponents(const glm::vec4& vector, std::string& output);
+	};
+}
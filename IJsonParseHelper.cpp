@@ -6,4 +6,21 @@ namespace FieaGameEngine
 	RTTI_DEFINITIONS(IJsonParseHelper);
 	void IJsonParseHelper::Initialize() {};
 
+	bool IJsonParseHelper::StartStringHandler(JsonParseCoordinator::SharedData& data, const std::string& key, std::string_view value, bool isArray)
+	{
+		return StartHandler(data, key, Json::Value(value.data(), value.data() + value.size()), isArray);
+	}
+
+	bool IJsonParseHelper::StartObjectHandler(JsonParseCoordinator::SharedData& data, const std::string& key)
+	{
+		UNREFERENCED_LOCAL(data);
+		UNREFERENCED_LOCAL(key);
+		return false;
+	}
+
+	bool IJsonParseHelper::EndObjectHandler(JsonParseCoordinator::SharedData& data, const std::string& key)
+	{
+		return EndHandler(data, key);
+	}
+
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <json/json.h>
 #include "JsonParseCoordinator.h"
 #include "RTTI.h"
@@ -41,6 +42,37 @@ namespace FieaGameEngine
 		/// <returns>whenter or not the handler could end the process</returns>
 		virtual bool EndHandler(JsonParseCoordinator::SharedData& data, const std::string& key) = 0;
 
+		/// <summary>
+		/// used instead of StartHandler for strings when the coordinator is streaming
+		/// the string is still in the tokenizer's buffer, so a helper that stores it can copy it straight from there
+		/// the default wraps it in a Json::Value and calls StartHandler
+		/// </summary>
+		/// <param name="data">the shared data to push into</param>
+		/// <param name="key">the key of the string</param>
+		/// <param name="value">the string, only valid until this returns</param>
+		/// <param name="isArray">whether or not the string is an element of an array</param>
+		/// <returns>whether or not this helper handles this string</returns>
+		virtual bool StartStringHandler(JsonParseCoordinator::SharedData& data, const std::string& key, std::string_view value, bool isArray);
+
+		/// <summary>
+		/// used instead of StartHandler for objects when the coordinator is streaming
+		/// the object's members haven't been read yet, they are handed to the helpers one at a time after this returns
+		/// the default doesn't handle any objects
+		/// </summary>
+		/// <param name="data">the shared data to push into</param>
+		/// <param name="key">the key of the object</param>
+		/// <returns>whether or not this helper handles this object</returns>
+		virtual bool StartObjectHandler(JsonParseCoordinator::SharedData& data, const std::string& key);
+
+		/// <summary>
+		/// used instead of EndHandler for objects when the coordinator is streaming, called once all of the object's members are parsed
+		/// the default calls EndHandler
+		/// </summary>
+		/// <param name="data">the shared data being used</param>
+		/// <param name="key">the key of the object</param>
+		/// <returns>whether or not the handler could end the process</returns>
+		virtual bool EndObjectHandler(JsonParseCoordinator::SharedData& data, const std::string& key);
+
 		/// <summary>
 		/// creates a new helper of its type
 		/// to be implemented in a derived class
@@ -0,0 +1,169 @@
+#include "pch.h"
+#include "JobSystem.h"
+
+namespace FieaGameEngine
+{
+	thread_local const JobSystem* JobSystem::s_CurrentSystem = nullptr;
+	thread_local size_t JobSystem::s_CurrentIndex = 0;
+
+	bool JobSystem::Counter::IsDone() const
+	{
+		return m_Remaining.load(std::memory_order_acquire) == 0;
+	}
+
+	JobSystem::JobSystem(size_t workerCount) :
+		m_Queues(std::make_unique<WorkQueue[]>(workerCount + 1)), m_QueueCount(workerCount + 1)
+	{
+		m_Workers.Reserve(workerCount);
+		for (size_t i = 0; i < workerCount; ++i)
+		{
+			m_Workers.EmplaceBack(&JobSystem::WorkerLoop, this, i);
+		}
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_WakeMutex);
+			m_IsRunning = false;
+		}
+		m_WakeCondition.notify_all();
+
+		for (std::thread& worker : m_Workers)
+		{
+			worker.join();
+		}
+
+		while (TryRunJob(m_QueueCount - 1));
+	}
+
+	void JobSystem::Submit(Job job, Counter& counter)
+	{
+		counter.m_Remaining.fetch_add(1, std::memory_order_relaxed);
+
+		WorkQueue& queue = m_Queues[QueueIndex()];
+		{
+			std::lock_guard<std::mutex> lock(queue.m_Mutex);
+			queue.m_Jobs.push_back(QueuedJob{ std::move(job), &counter });
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_WakeMutex);
+			m_QueuedJobs.fetch_add(1, std::memory_order_relaxed);
+		}
+		m_WakeCondition.notify_one();
+	}
+
+	void JobSystem::Wait(Counter& counter)
+	{
+		size_t index = QueueIndex();
+
+		while (!counter.IsDone())
+		{
+			if (!TryRunJob(index))
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(counter.m_Mutex);
+		if (counter.m_Exception != nullptr)
+		{
+			std::exception_ptr exception = counter.m_Exception;
+			counter.m_Exception = nullptr;
+			std::rethrow_exception(exception);
+		}
+	}
+
+	size_t JobSystem::WorkerCount() const
+	{
+		return m_Workers.Size();
+	}
+
+	size_t JobSystem::DefaultWorkerCount()
+	{
+		size_t cores = std::thread::hardware_concurrency();
+		return (cores > 1) ? cores - 1 : 0;
+	}
+
+	void JobSystem::WorkerLoop(size_t index)
+	{
+		s_CurrentSystem = this;
+		s_CurrentIndex = index;
+
+		while (true)
+		{
+			if (TryRunJob(index))
+			{
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_WakeMutex);
+			m_WakeCondition.wait(lock, [this]() { return m_QueuedJobs.load(std::memory_order_relaxed) > 0 || !m_IsRunning; });
+
+			if (!m_IsRunning && m_QueuedJobs.load(std::memory_order_relaxed) == 0)
+			{
+				break;
+			}
+		}
+
+		s_CurrentSystem = nullptr;
+	}
+
+	bool JobSystem::TryRunJob(size_t index)
+	{
+		QueuedJob job{ nullptr, nullptr };
+		bool found = false;
+
+		{
+			WorkQueue& queue = m_Queues[index];
+			std::lock_guard<std::mutex> lock(queue.m_Mutex);
+			if (!queue.m_Jobs.empty())
+			{
+				job = std::move(queue.m_Jobs.back());
+				queue.m_Jobs.pop_back();
+				found = true;
+			}
+		}
+
+		for (size_t i = 1; i < m_QueueCount && !found; ++i)
+		{
+			WorkQueue& victim = m_Queues[(index + i) % m_QueueCount];
+			std::lock_guard<std::mutex> lock(victim.m_Mutex);
+			if (!victim.m_Jobs.empty())
+			{
+				job = std::move(victim.m_Jobs.front());
+				victim.m_Jobs.pop_front();
+				found = true;
+			}
+		}
+
+		if (!found)
+		{
+			return false;
+		}
+
+		m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+
+		try
+		{
+			job.m_Job();
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(job.m_Counter->m_Mutex);
+			if (job.m_Counter->m_Exception == nullptr)
+			{
+				job.m_Counter->m_Exception = std::current_exception();
+			}
+		}
+
+		job.m_Counter->m_Remaining.fetch_sub(1, std::memory_order_acq_rel);
+		return true;
+	}
+
+	size_t JobSystem::QueueIndex() const
+	{
+		return (s_CurrentSystem == this) ? s_CurrentIndex : m_QueueCount - 1;
+	}
+}
\ No newline at end of file
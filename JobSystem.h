@@ -0,0 +1,214 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// JobSystem class
+	/// a pool of worker threads that run small jobs
+	/// every worker has its own queue and takes from the back of it, when it runs dry it steals from the front of the others
+	/// the thread that waits on a batch of jobs helps run them, so a system with zero workers still works
+	/// </summary>
+	class JobSystem final
+	{
+	public:
+		using Job = std::function<void()>;
+
+		/// <summary>
+		/// tracks a batch of jobs so they can be waited on together
+		/// holds onto the first exception a job throws so Wait can rethrow it
+		/// </summary>
+		class Counter final
+		{
+			friend JobSystem;
+
+		public:
+			/// <summary>
+			/// defaulted constructor for counter
+			/// </summary>
+			Counter() = default;
+
+			/// <summary>
+			/// deleted copy constructor
+			/// </summary>
+			Counter(const Counter&) = delete;
+
+			/// <summary>
+			/// deleted copy assignment operator
+			/// </summary>
+			Counter& operator=(const Counter&) = delete;
+
+			/// <summary>
+			/// returns whether or not every job in the batch has finished
+			/// </summary>
+			/// <returns>whether or not the batch is done</returns>
+			bool IsDone() const;
+
+		private:
+			/// <summary>
+			/// the number of jobs in the batch that haven't finished
+			/// </summary>
+			std::atomic<size_t> m_Remaining = 0;
+
+			/// <summary>
+			/// guards m_Exception
+			/// </summary>
+			std::mutex m_Mutex;
+
+			/// <summary>
+			/// the first exception thrown by a job in the batch
+			/// </summary>
+			std::exception_ptr m_Exception;
+		};
+
+		/// <summary>
+		/// constructor for the job system
+		/// </summary>
+		/// <param name="workerCount">the number of worker threads, defaults to one less than the number of cores</param>
+		explicit JobSystem(size_t workerCount = DefaultWorkerCount());
+
+		/// <summary>
+		/// deleted copy constructor
+		/// </summary>
+		JobSystem(const JobSystem&) = delete;
+
+		/// <summary>
+		/// deleted move constructor
+		/// </summary>
+		JobSystem(JobSystem&&) = delete;
+
+		/// <summary>
+		/// deleted copy assignment operator
+		/// </summary>
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		/// <summary>
+		/// deleted move assignment operator
+		/// </summary>
+		JobSystem& operator=(JobSystem&&) = delete;
+
+		/// <summary>
+		/// destructor for the job system
+		/// finishes any queued jobs, then joins the workers
+		/// </summary>
+		~JobSystem();
+
+		/// <summary>
+		/// queues a job
+		/// a worker queues onto its own queue, any other thread queues onto the shared one
+		/// </summary>
+		/// <param name="job">the job to be run</param>
+		/// <param name="counter">the batch the job belongs to</param>
+		void Submit(Job job, Counter& counter);
+
+		/// <summary>
+		/// runs queued jobs until every job in the batch has finished
+		/// </summary>
+		/// <param name="counter">the batch to wait on</param>
+		/// <exception cref="exception">rethrows the first exception thrown by a job in the batch</exception>
+		void Wait(Counter& counter);
+
+		/// <summary>
+		/// returns the number of worker threads
+		/// </summary>
+		/// <returns>the number of worker threads</returns>
+		size_t WorkerCount() const;
+
+		/// <summary>
+		/// returns one less than the number of cores, leaving one for the thread that submits the work
+		/// </summary>
+		/// <returns>the default number of workers</returns>
+		static size_t DefaultWorkerCount();
+
+	private:
+		/// <summary>
+		/// a job and the batch it belongs to
+		/// </summary>
+		struct QueuedJob final
+		{
+			Job m_Job;
+			Counter* m_Counter;
+		};
+
+		/// <summary>
+		/// one thread's queue
+		/// </summary>
+		struct WorkQueue final
+		{
+			std::mutex m_Mutex;
+			std::deque<QueuedJob> m_Jobs;
+		};
+
+		/// <summary>
+		/// the loop each worker runs until the system is destroyed
+		/// </summary>
+		/// <param name="index">the index of the worker's queue</param>
+		void WorkerLoop(size_t index);
+
+		/// <summary>
+		/// runs one job, taken from the back of the given queue or stolen from the front of another
+		/// </summary>
+		/// <param name="index">the index of the calling thread's queue</param>
+		/// <returns>whether or not a job was run</returns>
+		bool TryRunJob(size_t index);
+
+		/// <summary>
+		/// returns the index of the calling thread's queue, the shared queue for threads that aren't workers
+		/// </summary>
+		/// <returns>the index of the queue</returns>
+		size_t QueueIndex() const;
+
+		/// <summary>
+		/// the queues, one per worker followed by the shared one
+		/// </summary>
+		std::unique_ptr<WorkQueue[]> m_Queues;
+
+		/// <summary>
+		/// the number of queues
+		/// </summary>
+		size_t m_QueueCount;
+
+		/// <summary>
+		/// the worker threads
+		/// </summary>
+		Vector<std::thread> m_Workers;
+
+		/// <summary>
+		/// the number of jobs sitting in the queues, lets idle workers sleep
+		/// </summary>
+		std::atomic<size_t> m_QueuedJobs = 0;
+
+		/// <summary>
+		/// cleared when the system is destroyed
+		/// </summary>
+		std::atomic<bool> m_IsRunning = true;
+
+		/// <summary>
+		/// guards sleeping and waking the workers
+		/// </summary>
+		std::mutex m_WakeMutex;
+
+		/// <summary>
+		/// wakes the workers when jobs are queued
+		/// </summary>
+		std::condition_variable m_WakeCondition;
+
+		/// <summary>
+		/// the system the calling thread works for, nullptr if it isn't a worker
+		/// </summary>
+		static thread_local const JobSystem* s_CurrentSystem;
+
+		/// <summary>
+		/// the calling thread's queue index in s_CurrentSystem
+		/// </summary>
+		static thread_local size_t s_CurrentIndex;
+	};
+}
\ No newline at end of file
@@ -1,7 +1,9 @@
 #include "pch.h"
 #include "JsonParseCoordinator.h"
 #include "IJsonParseHelper.h"
-#include <fstream>
+#include "JobSystem.h"
+#include "JsonTokenizer.h"
+#include "MappedFile.h"
 #include <limits>
 
 namespace FieaGameEngine
@@ -9,6 +11,9 @@ namespace FieaGameEngine
 
 #pragma region SharedData
 	RTTI_DEFINITIONS(JsonParseCoordinator::SharedData);
+
+	JsonParseCoordinator::SharedData::~SharedData() {}
+
 	void JsonParseCoordinator::SharedData::Initialize() 
 	{
 		m_NestingDepth = 0;
@@ -44,6 +49,12 @@ namespace FieaGameEngine
 		--m_NestingDepth;
 	}
 
+	void JsonParseCoordinator::SharedData::Merge(SharedData& other)
+	{
+		UNREFERENCED_LOCAL(other);
+		throw std::runtime_error("Shared data cannot be merged");
+	}
+
 	size_t JsonParseCoordinator::SharedData::Depth()
 	{
 		if (m_NestingDepth == std::numeric_limits<size_t>::max())
@@ -67,7 +78,7 @@ namespace FieaGameEngine
 	}
 
 	JsonParseCoordinator::JsonParseCoordinator(JsonParseCoordinator&& toMove) noexcept
-		: m_Helpers(std::move(toMove.m_Helpers)), m_SharedData(toMove.m_SharedData), m_IsClone(toMove.m_IsClone)
+		: m_Helpers(std::move(toMove.m_Helpers)), m_SharedData(toMove.m_SharedData), m_IsClone(toMove.m_IsClone), m_ParseMode(toMove.m_ParseMode)
 	{
 		toMove.m_SharedData = nullptr;
 		toMove.m_IsClone = false;
@@ -80,6 +91,7 @@ namespace FieaGameEngine
 			m_Helpers = std::move(toMove.m_Helpers);
 
 			m_SharedData = toMove.m_SharedData;
+			m_ParseMode = toMove.m_ParseMode;
 			toMove.m_SharedData = nullptr;
 			toMove.m_IsClone = false;
 		}
@@ -98,6 +110,7 @@ namespace FieaGameEngine
 		}
 
 		clonedCoordinator->m_IsClone = true;
+		clonedCoordinator->m_ParseMode = m_ParseMode;
 
 		return clonedCoordinator;
 	}
@@ -158,17 +171,82 @@ namespace FieaGameEngine
 		return m_IsClone;
 	}
 
+	JsonParseCoordinator::ParseMode JsonParseCoordinator::GetParseMode() const
+	{
+		return m_ParseMode;
+	}
+
+	void JsonParseCoordinator::SetParseMode(ParseMode mode)
+	{
+		m_ParseMode = mode;
+	}
+
 	void JsonParseCoordinator::ParseFromFile(const std::string& fileName)
 	{
-		std::ifstream file(fileName, std::ifstream::binary);
-		Json::Value root;
-		file >> root;
+		MappedFile file(fileName);
+		Parse(file.Data(), file.Size());
+	}
 
-		ParseMembers(root);
+	void JsonParseCoordinator::ParseFiles(const Vector<std::string>& fileNames, JobSystem& jobSystem)
+	{
+		size_t fileCount = fileNames.Size();
+		size_t cloneCount = std::max<size_t>(std::min(jobSystem.WorkerCount(), fileCount), 1);
+
+		Vector<std::unique_ptr<JsonParseCoordinator>> clones(cloneCount);
+		for (size_t i = 0; i < cloneCount; ++i)
+		{
+			clones.EmplaceBack(Clone());
+		}
+
+		Vector<std::unique_ptr<SharedData>> results(fileCount);
+		for (size_t i = 0; i < fileCount; ++i)
+		{
+			results.EmplaceBack(m_SharedData->Create());
+		}
+
+		JobSystem::Counter counter;
+		for (size_t i = 0; i < cloneCount; ++i)
+		{
+			jobSystem.Submit([&fileNames, &clones, &results, cloneCount, i]()
+			{
+				JsonParseCoordinator& clone = *clones[i];
+				SharedData& cloneData = clone.GetSharedData();
+
+				try
+				{
+					for (size_t file = i; file < fileNames.Size(); file += cloneCount)
+					{
+						clone.SetSharedData(*results[file]);
+						clone.ParseFromFile(fileNames[file]);
+					}
+				}
+				catch (...)
+				{
+					clone.SetSharedData(cloneData);
+					throw;
+				}
+
+				//the clone deletes whatever shared data it has, so it gets its own back before it goes away
+				clone.SetSharedData(cloneData);
+			}, counter);
+		}
+		jobSystem.Wait(counter);
+
+		for (std::unique_ptr<SharedData>& result : results)
+		{
+			m_SharedData->Merge(*result);
+		}
 	}
 
 	void JsonParseCoordinator::Parse(std::istream& stream)
 	{
+		if (m_ParseMode == ParseMode::Streaming)
+		{
+			JsonTokenizer tokenizer(stream);
+			StreamDocument(tokenizer);
+			return;
+		}
+
 		Json::Value root;
 		stream >> root;
 
@@ -177,8 +255,29 @@ namespace FieaGameEngine
 
 	void JsonParseCoordinator::Parse(const std::string& jsonString)
 	{
-		std::istringstream inputStream(jsonString);
-		Parse(inputStream);
+		Parse(jsonString.data(), jsonString.size());
+	}
+
+	void JsonParseCoordinator::Parse(const char* data, size_t size)
+	{
+		if (m_ParseMode == ParseMode::Streaming)
+		{
+			JsonTokenizer tokenizer(data, size);
+			StreamDocument(tokenizer);
+			return;
+		}
+
+		Json::CharReaderBuilder builder;
+		std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+
+		Json::Value root;
+		std::string errors;
+		if (!reader->parse(data, data + size, &root, &errors))
+		{
+			throw std::runtime_error(errors);
+		}
+
+		ParseMembers(root);
 	}
 
 	void JsonParseCoordinator::Parse(const std::string& key, const Json::Value& value)
@@ -200,7 +299,7 @@ namespace FieaGameEngine
 
 		else if (value.isArray())
 		{
-			for (Json::Value element : value)
+			for (const Json::Value& element : value)
 			{
 				if (element.isObject())
 				{
@@ -217,13 +316,30 @@ namespace FieaGameEngine
 
 		else
 		{
-			for (IJsonParseHelper* helper : m_Helpers)
+			ParseScalar(key, value, false);
+		}
+	}
+
+	void JsonParseCoordinator::ParseScalar(const std::string& key, const Json::Value& value, bool isArray)
+	{
+		for (IJsonParseHelper* helper : m_Helpers)
+		{
+			if (helper->StartHandler(*m_SharedData, key, value, isArray))
 			{
-				if (helper->StartHandler(*m_SharedData, key, value, false))
-				{
-					helper->EndHandler(*m_SharedData, key);
-					break;
-				}
+				helper->EndHandler(*m_SharedData, key);
+				break;
+			}
+		}
+	}
+
+	void JsonParseCoordinator::ParseString(const std::string& key, std::string_view value, bool isArray)
+	{
+		for (IJsonParseHelper* helper : m_Helpers)
+		{
+			if (helper->StartStringHandler(*m_SharedData, key, value, isArray))
+			{
+				helper->EndHandler(*m_SharedData, key);
+				break;
 			}
 		}
 	}
@@ -235,10 +351,162 @@ namespace FieaGameEngine
 			throw std::runtime_error("Cannot parse empty value");
 		}
 
-		std::vector<std::string> keys = root.getMemberNames();
-		for (std::string& key : keys)
+		for (auto it = root.begin(); it != root.end(); ++it)
+		{
+			const std::string key = it.name();
+			Parse(key, *it);
+		}
+	}
+
+	void JsonParseCoordinator::StreamDocument(JsonTokenizer& tokenizer)
+	{
+		if (tokenizer.Next() != JsonTokenizer::TokenType::BeginObject)
+		{
+			tokenizer.Fail("expected an object");
+		}
+
+		StreamMembers(tokenizer);
+
+		if (tokenizer.Next() != JsonTokenizer::TokenType::End)
+		{
+			tokenizer.Fail("expected the end of the document");
+		}
+	}
+
+	void JsonParseCoordinator::StreamMembers(JsonTokenizer& tokenizer)
+	{
+		using TokenType = JsonTokenizer::TokenType;
+
+		if (tokenizer.Next() == TokenType::EndObject)
+		{
+			throw std::runtime_error("Cannot parse empty value");
+		}
+
+		while (true)
 		{
-			Parse(key, root[key]);
+			if (tokenizer.Type() != TokenType::String)
+			{
+				tokenizer.Fail("expected a key");
+			}
+
+			const std::string key(tokenizer.Text());
+
+			if (tokenizer.Next() != TokenType::Colon)
+			{
+				tokenizer.Fail("expected ':'");
+			}
+
+			tokenizer.Next();
+			StreamValue(tokenizer, key, false);
+
+			TokenType separator = tokenizer.Next();
+			if (separator == TokenType::EndObject)
+			{
+				return;
+			}
+
+			if (separator != TokenType::Comma)
+			{
+				tokenizer.Fail("expected ',' or '}'");
+			}
+
+			tokenizer.Next();
+		}
+	}
+
+	void JsonParseCoordinator::StreamValue(JsonTokenizer& tokenizer, const std::string& key, bool isArray)
+	{
+		using TokenType = JsonTokenizer::TokenType;
+
+		switch (tokenizer.Type())
+		{
+		case TokenType::BeginObject:
+		{
+			m_SharedData->IncrementDepth();
+
+			IJsonParseHelper* handler = nullptr;
+			for (IJsonParseHelper* helper : m_Helpers)
+			{
+				if (helper->StartObjectHandler(*m_SharedData, key))
+				{
+					handler = helper;
+					break;
+				}
+			}
+
+			if (handler != nullptr)
+			{
+				StreamMembers(tokenizer);
+				handler->EndObjectHandler(*m_SharedData, key);
+			}
+			else
+			{
+				tokenizer.Skip();
+			}
+
+			m_SharedData->DecrementDepth();
+			break;
+		}
+
+		case TokenType::BeginArray:
+		{
+			if (tokenizer.Next() == TokenType::EndArray)
+			{
+				break;
+			}
+
+			while (true)
+			{
+				if (tokenizer.Type() == TokenType::BeginObject)
+				{
+					m_SharedData->IncrementDepth();
+					StreamMembers(tokenizer);
+					m_SharedData->DecrementDepth();
+				}
+				else
+				{
+					StreamValue(tokenizer, key, true);
+				}
+
+				TokenType separator = tokenizer.Next();
+				if (separator == TokenType::EndArray)
+				{
+					break;
+				}
+
+				if (separator != TokenType::Comma)
+				{
+					tokenizer.Fail("expected ',' or ']'");
+				}
+
+				tokenizer.Next();
+			}
+			break;
+		}
+
+		case TokenType::String:
+			ParseString(key, tokenizer.Text(), isArray);
+			break;
+
+		case TokenType::Integer:
+			ParseScalar(key, Json::Value(static_cast<Json::Int64>(tokenizer.AsInteger())), isArray);
+			break;
+
+		case TokenType::Float:
+			ParseScalar(key, Json::Value(tokenizer.AsDouble()), isArray);
+			break;
+
+		case TokenType::True:
+		case TokenType::False:
+			ParseScalar(key, Json::Value(tokenizer.Type() == TokenType::True), isArray);
+			break;
+
+		case TokenType::Null:
+			ParseScalar(key, Json::Value(), isArray);
+			break;
+
+		default:
+			tokenizer.Fail("expected a value");
 		}
 	}
 
@@ -1,10 +1,13 @@
 #pragma once
+#include <string_view>
 #include "RTTI.h"
 #include "Vector.h"
 
 namespace FieaGameEngine
 {
 	class IJsonParseHelper;
+	class JobSystem;
+	class JsonTokenizer;
 
 	/// <summary>
 	/// JsonParseCoordinator class
@@ -43,7 +46,7 @@ namespace FieaGameEngine
 			/// <summary>
 			/// shared data pure virtual destructor
 			/// </summary>
-			~SharedData() = 0 {};
+			~SharedData() = 0;
 
 			/// <summary>
 			/// shared data default copy assignemnt operator
@@ -67,6 +70,14 @@ namespace FieaGameEngine
 			/// <returns>pointer the new shared data</returns>
 			virtual SharedData* Create() const = 0;
 
+			/// <summary>
+			/// folds what was parsed into another shared data of the same type into this one, as if it had been parsed into this
+			/// used to gather up the results of files parsed in parallel
+			/// </summary>
+			/// <param name="other">the shared data to take the results from</param>
+			/// <exception cref="runtime_error">throws an exception unless overridden, the base shared data has nothing to merge</exception>
+			virtual void Merge(SharedData& other);
+
 			/// <summary>
 			/// gets the JsonParseCoordinator associated with the shared data
 			/// </summary>
@@ -115,6 +126,20 @@ namespace FieaGameEngine
 		};
 
 	public:
+		/// <summary>
+		/// how the coordinator reads the json
+		/// Document reads the whole thing into a Json::Value first and then hands it to the helpers
+		/// Streaming hands everything to the helpers straight from the tokenizer, so memory use doesn't grow with the size of the document
+		/// when streaming, objects go to StartObjectHandler and EndObjectHandler, and members are seen in the order they are written
+		/// Document sees the members of an object in jsoncpp's order, which is sorted by key, so the two modes append a table's
+		/// auxiliary attributes in different orders, prescribed attributes are already in place and keep their slots either way
+		/// </summary>
+		enum class ParseMode
+		{
+			Document,
+			Streaming
+		};
+
 		/// <summary>
 		/// constructor for JsonParseCoordinator
 		/// takes in a sharedData and sets its own shared data pointer to point to it
@@ -208,6 +233,18 @@ namespace FieaGameEngine
 		/// <returns>whether or not the coordinator is a clone</returns>
 		bool IsClone() const;
 
+		/// <summary>
+		/// returns how the coordinator reads the json
+		/// </summary>
+		/// <returns>the parse mode</returns>
+		ParseMode GetParseMode() const;
+
+		/// <summary>
+		/// sets how the coordinator reads the json
+		/// </summary>
+		/// <param name="mode">the parse mode to set</param>
+		void SetParseMode(ParseMode mode);
+
 		/// <summary>
 		/// parses values from a string of json data
 		/// </summary>
@@ -220,12 +257,31 @@ namespace FieaGameEngine
 		/// <param name="stream">the string to parse</param>
 		void Parse(std::istream& stream);
 
+		/// <summary>
+		/// parses json that is already in memory, without copying it into a stream first
+		/// </summary>
+		/// <param name="data">the first byte of the json</param>
+		/// <param name="size">the number of bytes of json</param>
+		void Parse(const char* data, size_t size);
+
 		/// <summary>
 		/// parses data from a json file
+		/// the file is memory mapped and parsed in place, anything that can't be mapped, like a pipe, is read into memory first
 		/// </summary>
 		/// <param name="fileName">the name of the file to be parsed</param>
+		/// <exception cref="runtime_error">throws an exception if the file can't be opened</exception>
 		void ParseFromFile(const std::string& fileName);
 
+		/// <summary>
+		/// parses a list of json files in parallel, with one clone of the coordinator per worker
+		/// each file is parsed into its own shared data, and they are merged into this one in the order the files are listed,
+		/// so the result is the same as parsing them one after another
+		/// </summary>
+		/// <param name="fileNames">the names of the files to be parsed</param>
+		/// <param name="jobSystem">the job system to parse the files on</param>
+		/// <exception cref="runtime_error">rethrows the first exception thrown while parsing, once every file is done</exception>
+		void ParseFiles(const Vector<std::string>& fileNames, JobSystem& jobSystem);
+
 	private:
 		/// <summary>
 		/// deletes heap allocated helpers
@@ -246,6 +302,44 @@ namespace FieaGameEngine
 		/// <param name="value">the value to be parsed</param>
 		void Parse(const std::string& key, const Json::Value& value);
 
+		/// <summary>
+		/// goes through the helpers to see if any of them can handle a value that isn't an object or an array
+		/// </summary>
+		/// <param name="key">the key of the value</param>
+		/// <param name="value">the value to be parsed</param>
+		/// <param name="isArray">whether or not the value is an element of an array</param>
+		void ParseScalar(const std::string& key, const Json::Value& value, bool isArray);
+
+		/// <summary>
+		/// goes through the helpers to see if any of them can handle a streamed string, see IJsonParseHelper::StartStringHandler
+		/// </summary>
+		/// <param name="key">the key of the string</param>
+		/// <param name="value">the string, still in the tokenizer's buffer</param>
+		/// <param name="isArray">whether or not the string is an element of an array</param>
+		void ParseString(const std::string& key, std::string_view value, bool isArray);
+
+		/// <summary>
+		/// reads a whole document from the tokenizer and parses it as it comes, the root has to be an object
+		/// </summary>
+		/// <param name="tokenizer">the tokenizer to read from</param>
+		void StreamDocument(JsonTokenizer& tokenizer);
+
+		/// <summary>
+		/// reads the members of an object from the tokenizer and parses them as they come
+		/// the tokenizer has just read the object's opening brace
+		/// </summary>
+		/// <param name="tokenizer">the tokenizer to read from</param>
+		void StreamMembers(JsonTokenizer& tokenizer);
+
+		/// <summary>
+		/// reads a value from the tokenizer and parses it
+		/// the tokenizer has just read the value's first token
+		/// </summary>
+		/// <param name="tokenizer">the tokenizer to read from</param>
+		/// <param name="key">the key of the value</param>
+		/// <param name="isArray">whether or not the value is an element of an array</param>
+		void StreamValue(JsonTokenizer& tokenizer, const std::string& key, bool isArray);
+
 		/// <summary>
 		/// the list of helpers in this coordinator
 		/// </summary>
@@ -260,6 +354,11 @@ namespace FieaGameEngine
 		/// whether or not this cooridnator is a clone;
 		/// </summary>
 		bool m_IsClone = false;
+
+		/// <summary>
+		/// how the coordinator reads the json
+		/// </summary>
+		ParseMode m_ParseMode = ParseMode::Document;
 	};
 }
 
@@ -0,0 +1,446 @@
+#include "pch.h"
+#include "JsonTokenizer.h"
+#include <charconv>
+
+namespace FieaGameEngine
+{
+	JsonTokenizer::JsonTokenizer(std::istream& stream, size_t bufferSize) :
+		m_Stream(&stream), m_Buffer(std::make_unique<char[]>(bufferSize)), m_BufferSize(bufferSize)
+	{
+		if (bufferSize == 0)
+		{
+			throw std::runtime_error("buffer size cannot be zero");
+		}
+
+		m_Begin = m_Buffer.get();
+		m_Cursor = m_Begin;
+		m_End = m_Begin;
+	}
+
+	JsonTokenizer::JsonTokenizer(const char* data, size_t size) :
+		m_Stream(nullptr), m_BufferSize(0), m_Begin(data), m_Cursor(data), m_End(data + size)
+	{
+	}
+
+	JsonTokenizer::TokenType JsonTokenizer::Next()
+	{
+		m_Text.clear();
+		m_View = std::string_view();
+
+		int next = Peek();
+		while (next == ' ' || next == '\t' || next == '\n' || next == '\r')
+		{
+			++m_Cursor;
+			next = Peek();
+		}
+
+		if (next < 0)
+		{
+			m_Type = TokenType::End;
+			return m_Type;
+		}
+
+		char current = Get();
+		switch (current)
+		{
+		case '{':
+			m_Type = TokenType::BeginObject;
+			break;
+		case '}':
+			m_Type = TokenType::EndObject;
+			break;
+		case '[':
+			m_Type = TokenType::BeginArray;
+			break;
+		case ']':
+			m_Type = TokenType::EndArray;
+			break;
+		case ':':
+			m_Type = TokenType::Colon;
+			break;
+		case ',':
+			m_Type = TokenType::Comma;
+			break;
+		case '"':
+			ReadString();
+			m_Type = TokenType::String;
+			break;
+		case 't':
+			ReadLiteral("rue");
+			m_Type = TokenType::True;
+			break;
+		case 'f':
+			ReadLiteral("alse");
+			m_Type = TokenType::False;
+			break;
+		case 'n':
+			ReadLiteral("ull");
+			m_Type = TokenType::Null;
+			break;
+		default:
+			if (current == '-' || (current >= '0' && current <= '9'))
+			{
+				m_Type = ReadNumber(current);
+				break;
+			}
+			Fail(std::string("unexpected character '") + current + "'");
+		}
+
+		if (m_View.data() == nullptr)
+		{
+			m_View = m_Text;
+		}
+
+		return m_Type;
+	}
+
+	JsonTokenizer::TokenType JsonTokenizer::Type() const
+	{
+		return m_Type;
+	}
+
+	std::string_view JsonTokenizer::Text() const
+	{
+		return m_View;
+	}
+
+	std::int64_t JsonTokenizer::AsInteger() const
+	{
+		std::int64_t value;
+		auto [end, error] = std::from_chars(m_Text.data(), m_Text.data() + m_Text.size(), value);
+
+		if (error != std::errc() || end != m_Text.data() + m_Text.size())
+		{
+			Fail("integer out of range");
+		}
+
+		return value;
+	}
+
+	double JsonTokenizer::AsDouble() const
+	{
+		double value;
+		auto [end, error] = std::from_chars(m_Text.data(), m_Text.data() + m_Text.size(), value);
+
+		if (error != std::errc() || end != m_Text.data() + m_Text.size())
+		{
+			Fail("number out of range");
+		}
+
+		return value;
+	}
+
+	void JsonTokenizer::Skip()
+	{
+		if (m_Type != TokenType::BeginObject && m_Type != TokenType::BeginArray)
+		{
+			return;
+		}
+
+		size_t depth = 1;
+		while (depth > 0)
+		{
+			switch (Next())
+			{
+			case TokenType::BeginObject:
+			case TokenType::BeginArray:
+				++depth;
+				break;
+			case TokenType::EndObject:
+			case TokenType::EndArray:
+				--depth;
+				break;
+			case TokenType::End:
+				Fail("unexpected end of input");
+			default:
+				break;
+			}
+		}
+	}
+
+	size_t JsonTokenizer::Offset() const
+	{
+		return m_BufferOffset + static_cast<size_t>(m_Cursor - m_Begin);
+	}
+
+	int JsonTokenizer::Peek()
+	{
+		if (m_Cursor == m_End && !Refill())
+		{
+			return -1;
+		}
+
+		return static_cast<unsigned char>(*m_Cursor);
+	}
+
+	char JsonTokenizer::Get()
+	{
+		if (Peek() < 0)
+		{
+			Fail("unexpected end of input");
+		}
+
+		return *m_Cursor++;
+	}
+
+	bool JsonTokenizer::Refill()
+	{
+		if (m_Stream == nullptr)
+		{
+			return false;
+		}
+
+		m_BufferOffset += static_cast<size_t>(m_End - m_Begin);
+
+		m_Stream->read(m_Buffer.get(), static_cast<std::streamsize>(m_BufferSize));
+		size_t count = static_cast<size_t>(m_Stream->gcount());
+
+		m_Cursor = m_Begin;
+		m_End = m_Begin + count;
+		return count > 0;
+	}
+
+	void JsonTokenizer::ReadString()
+	{
+		const char* start = m_Cursor;
+
+		while (true)
+		{
+			//copy the run up to the next quote or escape in one go
+			const char* runStart = m_Cursor;
+			while (m_Cursor != m_End && *m_Cursor != '"' && *m_Cursor != '\\')
+			{
+				if (static_cast<unsigned char>(*m_Cursor) < 0x20)
+				{
+					Fail("control character in string");
+				}
+				++m_Cursor;
+			}
+
+			//a string in memory with nothing to unescape doesn't need copying
+			if (m_Stream == nullptr && runStart == start && m_Cursor != m_End && *m_Cursor == '"')
+			{
+				m_View = std::string_view(start, static_cast<size_t>(m_Cursor - start));
+				++m_Cursor;
+				return;
+			}
+
+			m_Text.append(runStart, m_Cursor);
+
+			char current = Get();
+			if (current == '"')
+			{
+				return;
+			}
+
+			if (current != '\\')
+			{
+				//the run stopped at the end of the buffer, Get refilled it
+				--m_Cursor;
+				continue;
+			}
+
+			char escaped = Get();
+			switch (escaped)
+			{
+			case '"':
+			case '\\':
+			case '/':
+				m_Text.push_back(escaped);
+				break;
+			case 'b':
+				m_Text.push_back('\b');
+				break;
+			case 'f':
+				m_Text.push_back('\f');
+				break;
+			case 'n':
+				m_Text.push_back('\n');
+				break;
+			case 'r':
+				m_Text.push_back('\r');
+				break;
+			case 't':
+				m_Text.push_back('\t');
+				break;
+			case 'u':
+			{
+				std::uint32_t codePoint = ReadHex();
+				if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+				{
+					if (Get() != '\\' || Get() != 'u')
+					{
+						Fail("unpaired surrogate in string");
+					}
+
+					std::uint32_t low = ReadHex();
+					if (low < 0xDC00 || low > 0xDFFF)
+					{
+						Fail("unpaired surrogate in string");
+					}
+
+					codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+				}
+				AppendUtf8(codePoint);
+				break;
+			}
+			default:
+				Fail(std::string("invalid escape '\\") + escaped + "'");
+			}
+		}
+	}
+
+	std::uint32_t JsonTokenizer::ReadHex()
+	{
+		std::uint32_t value = 0;
+
+		for (size_t i = 0; i < 4; ++i)
+		{
+			char digit = Get();
+			value <<= 4;
+
+			if (digit >= '0' && digit <= '9')
+			{
+				value |= static_cast<std::uint32_t>(digit - '0');
+			}
+			else if (digit >= 'a' && digit <= 'f')
+			{
+				value |= static_cast<std::uint32_t>(digit - 'a' + 10);
+			}
+			else if (digit >= 'A' && digit <= 'F')
+			{
+				value |= static_cast<std::uint32_t>(digit - 'A' + 10);
+			}
+			else
+			{
+				Fail("invalid \\u escape");
+			}
+		}
+
+		return value;
+	}
+
+	void JsonTokenizer::AppendUtf8(std::uint32_t codePoint)
+	{
+		if (codePoint < 0x80)
+		{
+			m_Text.push_back(static_cast<char>(codePoint));
+		}
+		else if (codePoint < 0x800)
+		{
+			m_Text.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+			m_Text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+		}
+		else if (codePoint < 0x10000)
+		{
+			m_Text.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+			m_Text.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+			m_Text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+		}
+		else
+		{
+			m_Text.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+			m_Text.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+			m_Text.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+			m_Text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+		}
+	}
+
+	JsonTokenizer::TokenType JsonTokenizer::ReadNumber(char first)
+	{
+		//-? (0 | [1-9][0-9]*) (.[0-9]+)? ([eE][+-]?[0-9]+)?
+		m_Text.push_back(first);
+		char leading = first;
+
+		if (first == '-')
+		{
+			int next = Peek();
+			if (next < '0' || next > '9')
+			{
+				Fail("invalid number");
+			}
+
+			leading = static_cast<char>(next);
+			m_Text.push_back(leading);
+			++m_Cursor;
+		}
+
+		if (leading != '0')
+		{
+			ReadDigits();
+		}
+
+		bool isFloat = false;
+
+		if (Peek() == '.')
+		{
+			m_Text.push_back('.');
+			++m_Cursor;
+			isFloat = true;
+
+			if (ReadDigits() == 0)
+			{
+				Fail("invalid number");
+			}
+		}
+
+		int next = Peek();
+		if (next == 'e' || next == 'E')
+		{
+			m_Text.push_back(static_cast<char>(next));
+			++m_Cursor;
+			isFloat = true;
+
+			next = Peek();
+			if (next == '+' || next == '-')
+			{
+				m_Text.push_back(static_cast<char>(next));
+				++m_Cursor;
+			}
+
+			if (ReadDigits() == 0)
+			{
+				Fail("invalid number");
+			}
+		}
+
+		//anything else that could be part of a number means it wasn't one, like 01, 1-2 or 1.2.3
+		next = Peek();
+		if ((next >= '0' && next <= '9') || next == '.' || next == 'e' || next == 'E' || next == '+' || next == '-')
+		{
+			Fail("invalid number");
+		}
+
+		return isFloat ? TokenType::Float : TokenType::Integer;
+	}
+
+	size_t JsonTokenizer::ReadDigits()
+	{
+		size_t count = 0;
+
+		for (int next = Peek(); next >= '0' && next <= '9'; next = Peek())
+		{
+			m_Text.push_back(static_cast<char>(next));
+			++m_Cursor;
+			++count;
+		}
+
+		return count;
+	}
+
+	void JsonTokenizer::ReadLiteral(const char* rest)
+	{
+		for (; *rest != '\0'; ++rest)
+		{
+			if (Get() != *rest)
+			{
+				Fail("invalid literal");
+			}
+		}
+	}
+
+	void JsonTokenizer::Fail(const std::string& message) const
+	{
+		throw std::runtime_error("json parse error at byte " + std::to_string(Offset()) + ": " + message);
+	}
+}
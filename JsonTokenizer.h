@@ -0,0 +1,229 @@
+#pragma once
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// JsonTokenizer class
+	/// splits json text into tokens one at a time, reading the stream through a fixed size buffer
+	/// only the buffer and the text of the current token are ever held in memory, no matter how big the document is
+	/// it can also read straight out of text that is already in memory, like a mapped file, in which case nothing is buffered
+	/// and strings without escapes are handed out as views into the text
+	/// </summary>
+	class JsonTokenizer final
+	{
+	public:
+		/// <summary>
+		/// the kinds of tokens
+		/// </summary>
+		enum class TokenType
+		{
+			BeginObject,
+			EndObject,
+			BeginArray,
+			EndArray,
+			Colon,
+			Comma,
+			String,
+			Integer,
+			Float,
+			True,
+			False,
+			Null,
+			End
+		};
+
+		/// <summary>
+		/// the default size of the read buffer
+		/// </summary>
+		static constexpr size_t s_DefaultBufferSize = 64 * 1024;
+
+		/// <summary>
+		/// constructor for the tokenizer
+		/// </summary>
+		/// <param name="stream">the stream to read the json from</param>
+		/// <param name="bufferSize">how many bytes are read from the stream at a time</param>
+		explicit JsonTokenizer(std::istream& stream, size_t bufferSize = s_DefaultBufferSize);
+
+		/// <summary>
+		/// constructor for the tokenizer over text that is already in memory
+		/// </summary>
+		/// <param name="data">the first byte of the json, it has to outlive the tokenizer</param>
+		/// <param name="size">the number of bytes of json</param>
+		JsonTokenizer(const char* data, size_t size);
+
+		/// <summary>
+		/// deleted copy constructor
+		/// </summary>
+		JsonTokenizer(const JsonTokenizer&) = delete;
+
+		/// <summary>
+		/// deleted copy assignment operator
+		/// </summary>
+		JsonTokenizer& operator=(const JsonTokenizer&) = delete;
+
+		/// <summary>
+		/// reads the next token
+		/// </summary>
+		/// <returns>the type of the token</returns>
+		/// <exception cref="runtime_error">throws an exception if the text isn't valid json</exception>
+		TokenType Next();
+
+		/// <summary>
+		/// returns the type of the current token
+		/// </summary>
+		/// <returns>the type of the current token</returns>
+		TokenType Type() const;
+
+		/// <summary>
+		/// returns the text of the current token, unescaped for strings
+		/// only valid until the next call to Next, or for as long as the text being read if it points into it
+		/// </summary>
+		/// <returns>the text of the current token</returns>
+		std::string_view Text() const;
+
+		/// <summary>
+		/// returns the current token as an integer
+		/// </summary>
+		/// <returns>the value of the token</returns>
+		/// <exception cref="runtime_error">throws an exception if the value doesn't fit in 64 bits</exception>
+		std::int64_t AsInteger() const;
+
+		/// <summary>
+		/// returns the current token as a double
+		/// </summary>
+		/// <returns>the value of the token</returns>
+		/// <exception cref="runtime_error">throws an exception if the value is too large for a double</exception>
+		double AsDouble() const;
+
+		/// <summary>
+		/// skips the rest of the value that the current token starts, the whole object or array if it is a begin token
+		/// </summary>
+		void Skip();
+
+		/// <summary>
+		/// returns how many bytes have been read
+		/// </summary>
+		/// <returns>the offset of the next byte to be read</returns>
+		size_t Offset() const;
+
+		/// <summary>
+		/// throws a runtime error that says where in the stream it happened
+		/// </summary>
+		/// <param name="message">what went wrong</param>
+		/// <exception cref="runtime_error">always</exception>
+		[[noreturn]] void Fail(const std::string& message) const;
+
+	private:
+		/// <summary>
+		/// returns the next byte without reading it, refilling the buffer if needed
+		/// </summary>
+		/// <returns>the next byte, or -1 at the end of the stream</returns>
+		int Peek();
+
+		/// <summary>
+		/// reads the next byte
+		/// </summary>
+		/// <returns>the next byte</returns>
+		/// <exception cref="runtime_error">throws an exception at the end of the stream</exception>
+		char Get();
+
+		/// <summary>
+		/// reads the next chunk of the stream into the buffer
+		/// </summary>
+		/// <returns>whether or not anything was read</returns>
+		bool Refill();
+
+		/// <summary>
+		/// reads a string token, the opening quote has already been read
+		/// </summary>
+		void ReadString();
+
+		/// <summary>
+		/// reads four hex digits of a \u escape
+		/// </summary>
+		/// <returns>the code unit</returns>
+		std::uint32_t ReadHex();
+
+		/// <summary>
+		/// appends a code point to the token text as utf-8
+		/// </summary>
+		/// <param name="codePoint">the code point to append</param>
+		void AppendUtf8(std::uint32_t codePoint);
+
+		/// <summary>
+		/// reads a number token, the first character has already been read
+		/// follows json's number grammar, so no leading zeros, no bare signs or dots, and digits after every dot and exponent
+		/// </summary>
+		/// <param name="first">the first character of the number</param>
+		/// <returns>whether the number is an integer or a float</returns>
+		/// <exception cref="runtime_error">throws an exception if the number isn't valid json</exception>
+		TokenType ReadNumber(char first);
+
+		/// <summary>
+		/// reads as many digits as come next into the token text
+		/// </summary>
+		/// <returns>the number of digits read</returns>
+		size_t ReadDigits();
+
+		/// <summary>
+		/// reads the rest of a true, false, or null literal
+		/// </summary>
+		/// <param name="rest">the characters that have to follow the first one</param>
+		void ReadLiteral(const char* rest);
+
+		/// <summary>
+		/// the stream being read, nullptr if the text is already in memory
+		/// </summary>
+		std::istream* m_Stream;
+
+		/// <summary>
+		/// the read buffer, nullptr if the text is already in memory
+		/// </summary>
+		std::unique_ptr<char[]> m_Buffer;
+
+		/// <summary>
+		/// the size of the read buffer
+		/// </summary>
+		size_t m_BufferSize;
+
+		/// <summary>
+		/// the first byte in the buffer, or of the text if it is already in memory
+		/// </summary>
+		const char* m_Begin;
+
+		/// <summary>
+		/// the next byte to be read in the buffer
+		/// </summary>
+		const char* m_Cursor;
+
+		/// <summary>
+		/// one past the last byte in the buffer
+		/// </summary>
+		const char* m_End;
+
+		/// <summary>
+		/// the number of bytes read before the start of the buffer
+		/// </summary>
+		size_t m_BufferOffset = 0;
+
+		/// <summary>
+		/// the type of the current token
+		/// </summary>
+		TokenType m_Type = TokenType::End;
+
+		/// <summary>
+		/// the text of the current token, when it couldn't be pointed to in place
+		/// </summary>
+		std::string m_Text;
+
+		/// <summary>
+		/// the text of the current token, either m_Text or a string in the text being read
+		/// </summary>
+		std::string_view m_View;
+	};
+}
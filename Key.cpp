@@ -0,0 +1,165 @@
+#include "pch.h"
+#include "Key.h"
+#include "Vector.h"
+#include <atomic>
+#include <mutex>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// the global intern table
+	/// an open addressed array of entries that are only ever added, so looking a string up never takes a lock
+	/// interning a new string takes the mutex, and growing publishes a new array without freeing the old one,
+	/// since a lookup on another thread may still be walking it
+	/// </summary>
+	struct Key::Table final
+	{
+		/// <summary>
+		/// one array of slots, a power of two long
+		/// </summary>
+		struct Slots final
+		{
+			explicit Slots(size_t capacity) : m_Capacity(capacity), m_Entries(new std::atomic<const Entry*>[capacity])
+			{
+				for (size_t i = 0; i < capacity; ++i)
+				{
+					m_Entries[i].store(nullptr, std::memory_order_relaxed);
+				}
+			}
+
+			size_t m_Capacity;
+			std::unique_ptr<std::atomic<const Entry*>[]> m_Entries;
+		};
+
+		/// <summary>
+		/// finds the entry for a string in the current array, without locking
+		/// </summary>
+		/// <param name="name">the string to be found</param>
+		/// <param name="hash">the hash of the string</param>
+		/// <returns>the entry, or nullptr if the string was never interned</returns>
+		const Entry* Find(const std::string& name, size_t hash) const
+		{
+			const Slots& slots = *m_Slots.load(std::memory_order_acquire);
+			size_t mask = slots.m_Capacity - 1;
+
+			for (size_t index = hash & mask; ; index = (index + 1) & mask)
+			{
+				const Entry* entry = slots.m_Entries[index].load(std::memory_order_acquire);
+				if (entry == nullptr)
+				{
+					return nullptr;
+				}
+
+				if (entry->m_Hash == hash && entry->m_Name == name)
+				{
+					return entry;
+				}
+			}
+		}
+
+		/// <summary>
+		/// adds an entry, growing first if the array would be more than half full
+		/// has to be called with the mutex held
+		/// </summary>
+		/// <param name="entry">the entry to be added</param>
+		void Insert(const Entry* entry)
+		{
+			Slots* slots = m_Slots.load(std::memory_order_relaxed);
+
+			if ((m_Count + 1) * 2 > slots->m_Capacity)
+			{
+				Slots* grown = new Slots(slots->m_Capacity * 2);
+				for (size_t i = 0; i < slots->m_Capacity; ++i)
+				{
+					const Entry* moved = slots->m_Entries[i].load(std::memory_order_relaxed);
+					if (moved != nullptr)
+					{
+						Place(*grown, moved);
+					}
+				}
+
+				m_Retired.PushBack(slots);
+				m_Slots.store(grown, std::memory_order_release);
+				slots = grown;
+			}
+
+			Place(*slots, entry);
+			++m_Count;
+		}
+
+		/// <summary>
+		/// stores an entry in the first empty slot after its home slot
+		/// </summary>
+		/// <param name="slots">the array to store it in</param>
+		/// <param name="entry">the entry</param>
+		static void Place(Slots& slots, const Entry* entry)
+		{
+			size_t mask = slots.m_Capacity - 1;
+			size_t index = entry->m_Hash & mask;
+
+			while (slots.m_Entries[index].load(std::memory_order_relaxed) != nullptr)
+			{
+				index = (index + 1) & mask;
+			}
+
+			slots.m_Entries[index].store(entry, std::memory_order_release);
+		}
+
+		std::mutex m_Mutex;
+		std::atomic<Slots*> m_Slots{ new Slots(2048) };
+		Vector<Slots*> m_Retired;
+		size_t m_Count = 0;
+	};
+
+	Key::Key(const std::string& name)
+	{
+		Table& table = GetTable();
+
+		DefaultHash<std::string> hash;
+		size_t hashed = hash(name);
+
+		m_Entry = table.Find(name, hashed);
+		if (m_Entry != nullptr)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(table.m_Mutex);
+		m_Entry = table.Find(name, hashed);
+		if (m_Entry != nullptr)
+		{
+			return;
+		}
+
+		Entry* entry = new Entry{ name, hashed };
+		table.Insert(entry);
+		m_Entry = entry;
+	}
+
+	Key Key::Find(const std::string& name)
+	{
+		DefaultHash<std::string> hash;
+
+		Key key;
+		key.m_Entry = GetTable().Find(name, hash(name));
+		return key;
+	}
+
+	const std::string& Key::Name() const
+	{
+		static const std::string empty;
+		return (m_Entry != nullptr) ? m_Entry->m_Name : empty;
+	}
+
+	Key::operator const std::string&() const
+	{
+		return Name();
+	}
+
+	Key::Table& Key::GetTable()
+	{
+		//never destroyed, keys held by statics in other translation units have to outlive it
+		static Table* table = new Table();
+		return *table;
+	}
+}
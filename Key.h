@@ -0,0 +1,138 @@
+#pragma once
+#include <string>
+#include "DefaultHash.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Key class
+	/// an interned string, every Key made from the same characters points at the same entry in a global table
+	/// comparing two keys is a pointer compare, and the hash is worked out once when the string is first interned
+	/// entries are never freed, so keys are safe to hold onto for the life of the program
+	/// looking a string up never takes a lock, only interning one that hasn't been seen before does
+	/// </summary>
+	class Key final
+	{
+	public:
+		/// <summary>
+		/// default constructor for key
+		/// makes a null key that matches nothing
+		/// </summary>
+		Key() = default;
+
+		/// <summary>
+		/// constructor for key
+		/// interns the string if it hasn't been seen before, which is the only time it locks the table
+		/// </summary>
+		/// <param name="name">the string to be interned</param>
+		explicit Key(const std::string& name);
+
+		/// <summary>
+		/// looks up a string without interning it
+		/// a string that was never interned can't be a key in any scope, so there is no need to add it
+		/// never takes a lock, so lookups from any number of threads don't contend, but it still hashes the string,
+		/// so code that looks the same string up over and over should hold onto the key instead
+		/// </summary>
+		/// <param name="name">the string to be found</param>
+		/// <returns>the key for that string, or a null key if it was never interned</returns>
+		static Key Find(const std::string& name);
+
+		/// <summary>
+		/// returns the string the key was made from
+		/// </summary>
+		/// <returns>the interned string, or an empty string for a null key</returns>
+		const std::string& Name() const;
+
+		/// <summary>
+		/// returns the hash that was worked out when the string was interned
+		/// </summary>
+		/// <returns>the hash of the string, 0 for a null key</returns>
+		size_t Hash() const;
+
+		/// <summary>
+		/// returns whether or not this is a null key
+		/// </summary>
+		/// <returns>true if the key was default constructed or came from a failed Find</returns>
+		bool IsNull() const;
+
+		/// <summary>
+		/// lets a key be passed anywhere a string is expected
+		/// </summary>
+		operator const std::string&() const;
+
+		/// <summary>
+		/// == operator for key
+		/// </summary>
+		/// <param name="other">the key being compared</param>
+		/// <returns>whether or not both keys were made from the same string</returns>
+		bool operator==(const Key& other) const;
+
+		/// <summary>
+		/// != operator for key
+		/// </summary>
+		/// <param name="other">the key being compared</param>
+		/// <returns>whether or not the keys were made from different strings</returns>
+		bool operator!=(const Key& other) const;
+
+	private:
+		/// <summary>
+		/// one interned string and its hash
+		/// </summary>
+		struct Entry final
+		{
+			std::string m_Name;
+			size_t m_Hash;
+		};
+
+		struct Table;
+
+		/// <summary>
+		/// returns the global intern table, creating it the first time
+		/// </summary>
+		/// <returns>the intern table</returns>
+		static Table& GetTable();
+
+		/// <summary>
+		/// the entry in the intern table, nullptr for a null key
+		/// </summary>
+		const Entry* m_Entry = nullptr;
+	};
+
+	inline size_t Key::Hash() const
+	{
+		return (m_Entry != nullptr) ? m_Entry->m_Hash : 0;
+	}
+
+	inline bool Key::IsNull() const
+	{
+		return m_Entry == nullptr;
+	}
+
+	inline bool Key::operator==(const Key& other) const
+	{
+		return m_Entry == other.m_Entry;
+	}
+
+	inline bool Key::operator!=(const Key& other) const
+	{
+		return m_Entry != other.m_Entry;
+	}
+
+	template<typename HashPolicy>
+	struct DefaultHash<Key, HashPolicy> final
+	{
+		inline size_t operator()(const Key& key) const
+		{
+			return key.Hash();
+		}
+	};
+
+	template<typename HashPolicy>
+	struct DefaultHash<const Key, HashPolicy> final
+	{
+		inline size_t operator()(const Key& key) const
+		{
+			return key.Hash();
+		}
+	};
+}
@@ -0,0 +1,188 @@
+#include "pch.h"
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace FieaGameEngine
+{
+#ifdef _WIN32
+	MappedFile::MappedFile(const std::string& fileName)
+	{
+		HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			throw std::runtime_error("Could not open " + fileName);
+		}
+
+		LARGE_INTEGER size;
+		if (GetFileType(file) == FILE_TYPE_DISK && GetFileSizeEx(file, &size) && size.QuadPart > 0)
+		{
+			//the view keeps the mapping open on its own, so its handle can be closed right away
+			HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (mapping != nullptr)
+			{
+				m_Mapping = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+				CloseHandle(mapping);
+			}
+		}
+
+		if (m_Mapping != nullptr)
+		{
+			m_Data = static_cast<const char*>(m_Mapping);
+			m_Size = static_cast<size_t>(size.QuadPart);
+			CloseHandle(file);
+			return;
+		}
+
+		try
+		{
+			ReadAll(file);
+		}
+		catch (...)
+		{
+			CloseHandle(file);
+			throw;
+		}
+		CloseHandle(file);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if (m_Mapping != nullptr)
+		{
+			UnmapViewOfFile(m_Mapping);
+		}
+	}
+
+	void MappedFile::ReadAll(void* file)
+	{
+		char buffer[64 * 1024];
+		DWORD count;
+
+		while (true)
+		{
+			if (!ReadFile(file, buffer, sizeof(buffer), &count, nullptr))
+			{
+				//a pipe reports that the other end closed as an error
+				if (GetLastError() == ERROR_BROKEN_PIPE)
+				{
+					break;
+				}
+				throw std::runtime_error("Could not read the file");
+			}
+
+			if (count == 0)
+			{
+				break;
+			}
+
+			m_Contents.append(buffer, count);
+		}
+
+		m_Data = m_Contents.data();
+		m_Size = m_Contents.size();
+	}
+#else
+	MappedFile::MappedFile(const std::string& fileName)
+	{
+		int file = open(fileName.c_str(), O_RDONLY);
+		if (file < 0)
+		{
+			throw std::runtime_error("Could not open " + fileName);
+		}
+
+		struct stat status;
+		if (fstat(file, &status) == 0 && S_ISREG(status.st_mode) && status.st_size > 0)
+		{
+			void* mapping = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+			if (mapping != MAP_FAILED)
+			{
+				madvise(mapping, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+
+				//the mapping keeps the file open on its own, so the descriptor can be closed right away
+				m_Mapping = mapping;
+				m_Data = static_cast<const char*>(mapping);
+				m_Size = static_cast<size_t>(status.st_size);
+				close(file);
+				return;
+			}
+		}
+
+		try
+		{
+			ReadAll(file);
+		}
+		catch (...)
+		{
+			close(file);
+			throw;
+		}
+		close(file);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if (m_Mapping != nullptr)
+		{
+			munmap(m_Mapping, m_Size);
+		}
+	}
+
+	void MappedFile::ReadAll(int file)
+	{
+		char buffer[64 * 1024];
+
+		while (true)
+		{
+			ssize_t count = read(file, buffer, sizeof(buffer));
+			if (count == 0)
+			{
+				break;
+			}
+
+			if (count < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+				throw std::runtime_error("Could not read the file");
+			}
+
+			m_Contents.append(buffer, static_cast<size_t>(count));
+		}
+
+		m_Data = m_Contents.data();
+		m_Size = m_Contents.size();
+	}
+#endif
+
+	const char* MappedFile::Data() const
+	{
+		return m_Data;
+	}
+
+	size_t MappedFile::Size() const
+	{
+		return m_Size;
+	}
+
+	bool MappedFile::IsMapped() const
+	{
+		return (m_Mapping != nullptr);
+	}
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <string>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// MappedFile class
+	/// a read-only view of a whole file, memory mapped so the bytes are never copied through a stream buffer
+	/// files that can't be mapped, like pipes and /dev/stdin, are read into memory instead so they look the same from the outside
+	/// </summary>
+	class MappedFile final
+	{
+	public:
+		/// <summary>
+		/// constructor for the mapped file, maps the whole file
+		/// </summary>
+		/// <param name="fileName">the name of the file to map</param>
+		/// <exception cref="runtime_error">throws an exception if the file can't be opened</exception>
+		explicit MappedFile(const std::string& fileName);
+
+		/// <summary>
+		/// deleted copy constructor
+		/// </summary>
+		MappedFile(const MappedFile&) = delete;
+
+		/// <summary>
+		/// deleted copy assignment operator
+		/// </summary>
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		/// <summary>
+		/// destructor for the mapped file, unmaps it
+		/// </summary>
+		~MappedFile();
+
+		/// <summary>
+		/// returns the first byte of the file
+		/// </summary>
+		/// <returns>the first byte of the file, only valid while the mapped file is alive</returns>
+		const char* Data() const;
+
+		/// <summary>
+		/// returns the size of the file
+		/// </summary>
+		/// <returns>the number of bytes in the file</returns>
+		size_t Size() const;
+
+		/// <summary>
+		/// returns whether the file is mapped, or was read into memory because it couldn't be
+		/// </summary>
+		/// <returns>whether or not the file is mapped</returns>
+		bool IsMapped() const;
+
+	private:
+		/// <summary>
+		/// reads the rest of an open file into memory, for files that can't be mapped
+		/// it reads from the file that is already open instead of opening it again, since a pipe can only be read once
+		/// </summary>
+		/// <param name="file">the open file to read</param>
+		/// <exception cref="runtime_error">throws an exception if reading fails</exception>
+#ifdef _WIN32
+		void ReadAll(void* file);
+#else
+		void ReadAll(int file);
+#endif
+
+		/// <summary>
+		/// the first byte of the file
+		/// </summary>
+		const char* m_Data = nullptr;
+
+		/// <summary>
+		/// the number of bytes in the file
+		/// </summary>
+		size_t m_Size = 0;
+
+		/// <summary>
+		/// the start of the mapping, nullptr if the file isn't mapped
+		/// </summary>
+		void* m_Mapping = nullptr;
+
+		/// <summary>
+		/// the bytes of a file that couldn't be mapped
+		/// </summary>
+		std::string m_Contents;
+	};
+}
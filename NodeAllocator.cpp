@@ -0,0 +1,145 @@
+#include "pch.h"
+#include "NodeAllocator.h"
+#include "SlabAllocator.h"
+
+namespace FieaGameEngine
+{
+	void* HeapNodeAllocator::Allocate(size_t size)
+	{
+		return ::operator new(size, std::align_val_t{ SlabAllocator::s_Granularity });
+	}
+
+	void HeapNodeAllocator::Deallocate(void* node, size_t)
+	{
+		::operator delete(node, std::align_val_t{ SlabAllocator::s_Granularity });
+	}
+
+	namespace
+	{
+		/// <summary>
+		/// the free lists for one thread, one per slab size class up to the biggest pooled node
+		/// trivially destructible so it can still be reached while statics are being torn down
+		/// </summary>
+		struct NodeCache final
+		{
+			static constexpr size_t s_ClassCount = PooledNodeAllocator::s_MaxNodeSize / SlabAllocator::s_Granularity;
+
+			struct FreeNode final
+			{
+				FreeNode* m_Next;
+			};
+
+			FreeNode* m_Lists[s_ClassCount];
+			size_t m_Counts[s_ClassCount];
+
+			/// <summary>
+			/// set once the thread's lists have been given back, from then on nodes go straight to the slab allocator
+			/// </summary>
+			bool m_Closed;
+
+			static size_t ClassIndex(size_t size)
+			{
+				return (size - 1) / SlabAllocator::s_Granularity;
+			}
+
+			static size_t ClassSize(size_t index)
+			{
+				return (index + 1) * SlabAllocator::s_Granularity;
+			}
+
+			void Release(size_t index, size_t count)
+			{
+				SlabAllocator& slab = SlabAllocator::Instance();
+				for (size_t i = 0; i < count && m_Lists[index] != nullptr; ++i)
+				{
+					FreeNode* node = m_Lists[index];
+					m_Lists[index] = node->m_Next;
+					--m_Counts[index];
+					slab.Deallocate(node, ClassSize(index));
+				}
+			}
+		};
+
+		thread_local NodeCache s_NodeCache;
+
+		/// <summary>
+		/// gives the thread's free lists back to the slab allocator when the thread exits
+		/// </summary>
+		struct NodeCacheCloser final
+		{
+			~NodeCacheCloser()
+			{
+				for (size_t i = 0; i < NodeCache::s_ClassCount; ++i)
+				{
+					s_NodeCache.Release(i, s_NodeCache.m_Counts[i]);
+				}
+				s_NodeCache.m_Closed = true;
+			}
+		};
+
+		/// <summary>
+		/// returns this thread's cache, or nullptr once the thread is shutting down
+		/// </summary>
+		NodeCache* ThreadCache()
+		{
+			thread_local NodeCacheCloser closer;
+			return s_NodeCache.m_Closed ? nullptr : &s_NodeCache;
+		}
+	}
+
+	void* PooledNodeAllocator::Allocate(size_t size)
+	{
+		NodeCache* cache = (size == 0 || size > s_MaxNodeSize) ? nullptr : ThreadCache();
+
+		if (cache == nullptr)
+		{
+			return SlabAllocator::Instance().Allocate(size);
+		}
+
+		size_t index = NodeCache::ClassIndex(size);
+
+		if (cache->m_Lists[index] == nullptr)
+		{
+			SlabAllocator& slab = SlabAllocator::Instance();
+			for (size_t i = 0; i < s_RefillCount; ++i)
+			{
+				NodeCache::FreeNode* node = static_cast<NodeCache::FreeNode*>(slab.Allocate(NodeCache::ClassSize(index)));
+				node->m_Next = cache->m_Lists[index];
+				cache->m_Lists[index] = node;
+			}
+			cache->m_Counts[index] += s_RefillCount;
+		}
+
+		NodeCache::FreeNode* node = cache->m_Lists[index];
+		cache->m_Lists[index] = node->m_Next;
+		--cache->m_Counts[index];
+		return node;
+	}
+
+	void PooledNodeAllocator::Deallocate(void* node, size_t size)
+	{
+		if (node == nullptr)
+		{
+			return;
+		}
+
+		NodeCache* cache = (size == 0 || size > s_MaxNodeSize) ? nullptr : ThreadCache();
+
+		if (cache == nullptr)
+		{
+			SlabAllocator::Instance().Deallocate(node, size);
+			return;
+		}
+
+		size_t index = NodeCache::ClassIndex(size);
+
+		NodeCache::FreeNode* freeNode = static_cast<NodeCache::FreeNode*>(node);
+		freeNode->m_Next = cache->m_Lists[index];
+		cache->m_Lists[index] = freeNode;
+
+		if (++cache->m_Counts[index] > s_MaxCachedCount)
+		{
+			cache->Release(index, s_MaxCachedCount / 2);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+#include <cstdint>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// node allocator that goes straight to the heap, the way SList used to allocate, aligned the same as slab blocks
+	/// an allocator for SList is any type with static Allocate and Deallocate functions like these
+	/// </summary>
+	struct HeapNodeAllocator final
+	{
+		/// <summary>
+		/// allocates the memory for a node
+		/// </summary>
+		/// <param name="size">the size of the node in bytes</param>
+		/// <returns>the memory for the node</returns>
+		static void* Allocate(size_t size);
+
+		/// <summary>
+		/// frees the memory of a node
+		/// </summary>
+		/// <param name="node">the memory to be freed</param>
+		/// <param name="size">the size of the node in bytes</param>
+		static void Deallocate(void* node, size_t size);
+	};
+
+	/// <summary>
+	/// node allocator that keeps a free list per node size on each thread
+	/// pushing and popping is a pointer swap on the calling thread's list, it only takes a lock when a list needs to be
+	/// refilled from, or trimmed back into, the slab allocator
+	/// a node can be freed on a different thread than it was made on, it just ends up on that thread's list
+	/// </summary>
+	struct PooledNodeAllocator final
+	{
+		/// <summary>
+		/// the biggest node that is pooled, bigger ones come straight from the slab allocator
+		/// </summary>
+		static constexpr size_t s_MaxNodeSize = 256;
+
+		/// <summary>
+		/// how many nodes are taken from the slab allocator when a list runs dry
+		/// </summary>
+		static constexpr size_t s_RefillCount = 32;
+
+		/// <summary>
+		/// how many free nodes of one size a thread keeps before handing half of them back
+		/// </summary>
+		static constexpr size_t s_MaxCachedCount = 512;
+
+		/// <summary>
+		/// allocates the memory for a node
+		/// </summary>
+		/// <param name="size">the size of the node in bytes</param>
+		/// <returns>the memory for the node</returns>
+		static void* Allocate(size_t size);
+
+		/// <summary>
+		/// puts the memory of a node back on this thread's list
+		/// </summary>
+		/// <param name="node">the memory to be freed</param>
+		/// <param name="size">the size of the node in bytes</param>
+		static void Deallocate(void* node, size_t size);
+	};
+
+	/// <summary>
+	/// wraps a node allocator up as a standard library allocator, for things like shared_ptr control blocks
+	/// </summary>
+	/// <typeparam name="T">the type being allocated</typeparam>
+	/// <typeparam name="TAllocator">the node allocator to allocate from</typeparam>
+	template <typename T, typename TAllocator = PooledNodeAllocator>
+	struct NodeStdAllocator final
+	{
+		using value_type = T;
+
+		NodeStdAllocator() = default;
+
+		template <typename U>
+		NodeStdAllocator(const NodeStdAllocator<U, TAllocator>&) {}
+
+		T* allocate(size_t count)
+		{
+			return static_cast<T*>(TAllocator::Allocate(count * sizeof(T)));
+		}
+
+		void deallocate(T* pointer, size_t count)
+		{
+			TAllocator::Deallocate(pointer, count * sizeof(T));
+		}
+
+		template <typename U>
+		bool operator==(const NodeStdAllocator<U, TAllocator>&) const
+		{
+			return true;
+		}
+
+		template <typename U>
+		bool operator!=(const NodeStdAllocator<U, TAllocator>&) const
+		{
+			return false;
+		}
+	};
+}
\ No newline at end of file
@@ -15,6 +15,11 @@ namespace FieaGameEngine
 
 		virtual FieaGameEngine::RTTI::IdType TypeIdInstance() const = 0;
 
+		virtual std::string TypeNameInstance() const
+		{
+			return "RTTI";
+		}
+
 		virtual RTTI* QueryInterface(const IdType)
 		{
 			return nullptr;
@@ -58,6 +63,7 @@ namespace FieaGameEngine
 			static std::string TypeName() { return std::string(#Type); }														\
 			static FieaGameEngine::RTTI::IdType TypeIdClass() { return sRunTimeTypeId; }																\
 			FieaGameEngine::RTTI::IdType TypeIdInstance() const override { return TypeIdClass(); }											\
+			std::string TypeNameInstance() const override { return TypeName(); }																\
 			FieaGameEngine::RTTI* QueryInterface(const RTTI::IdType id) override												\
             {																													\
 				return (id == sRunTimeTypeId ? reinterpret_cast<FieaGameEngine::RTTI*>(this) : ParentType::QueryInterface(id)); \
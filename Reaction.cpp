@@ -6,4 +6,6 @@ namespace FieaGameEngine
 	RTTI_DEFINITIONS(Reaction);
 
 	Reaction::Reaction(RTTI::IdType id) : ActionList(id) {}
+
+	Reaction::~Reaction() {}
 }
\ No newline at end of file
@@ -16,7 +16,7 @@ namespace FieaGameEngine
 		/// <summary>
 		/// Reaction pure virtual destructor
 		/// </summary>
-		virtual ~Reaction() = 0 {};
+		virtual ~Reaction() = 0;
 
 	protected:
 		/// <summary>
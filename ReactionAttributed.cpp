@@ -9,16 +9,57 @@ namespace FieaGameEngine
 	
 	ReactionAttributed::ReactionAttributed() : Reaction(TypeIdInstance()) 
 	{
+		GetPrescribed<s_SubtypeSlot>().Watch();
 		Event<EventMessageAttributed>::Subscribe(*this);
 	}
 
+	ReactionAttributed::ReactionAttributed(const ReactionAttributed& other) :
+		Reaction(other), m_Subtype(other.m_Subtype), m_Route(other.m_Route)
+	{
+		GetPrescribed<s_SubtypeSlot>().Watch();
+	}
+
+	ReactionAttributed::ReactionAttributed(ReactionAttributed&& other) noexcept :
+		Reaction(std::move(other)), m_Subtype(std::move(other.m_Subtype)), m_Route(std::move(other.m_Route))
+	{
+		GetPrescribed<s_SubtypeSlot>().Watch();
+	}
+
+	ReactionAttributed& ReactionAttributed::operator=(const ReactionAttributed& other)
+	{
+		if (this != &other)
+		{
+			Reaction::operator=(other);
+			m_Subtype = other.m_Subtype;
+			m_Route = other.m_Route;
+			GetPrescribed<s_SubtypeSlot>().Watch();
+			RoutesChanged();
+		}
+
+		return *this;
+	}
+
+	ReactionAttributed& ReactionAttributed::operator=(ReactionAttributed&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Reaction::operator=(std::move(other));
+			m_Subtype = std::move(other.m_Subtype);
+			m_Route = std::move(other.m_Route);
+			GetPrescribed<s_SubtypeSlot>().Watch();
+			RoutesChanged();
+		}
+
+		return *this;
+	}
+
 	const Vector<Signature> ReactionAttributed::Signatures()
 	{
 		return Vector<Signature>
 		({
 			Signature("m_Name", Datum::DatumTypes::STRING, 1, offsetof(ReactionAttributed, m_Name)),
-			Signature("m_Subtype", Datum::DatumTypes::STRING, 1, offsetof(ReactionAttributed, m_Subtype)),
-			Signature("m_Actions", Datum::DatumTypes::TABLE, 0, 0)
+			Signature("m_Actions", Datum::DatumTypes::TABLE, 0, 0),
+			Signature("m_Subtype", Datum::DatumTypes::STRING, 1, offsetof(ReactionAttributed, m_Subtype))
 		});
 	}
 
@@ -29,12 +70,12 @@ namespace FieaGameEngine
 
 	const std::string& ReactionAttributed::GetSubtype() const
 	{
-		return m_Subtype;
+		return GetPrescribed<s_SubtypeSlot>().Get<std::string>();
 	}
 
 	void ReactionAttributed::SetSubtype(const std::string& subtype)
 	{
-		m_Subtype = subtype;
+		GetPrescribed<s_SubtypeSlot>() = subtype;
 	}
 
 	void ReactionAttributed::Notify(const EventPublisher& eventPub)
@@ -46,32 +87,53 @@ namespace FieaGameEngine
 			throw std::runtime_error("Event must be of type EventMessageAttributed");
 		}
 
-		const EventMessageAttributed& message = event->Message();
-
-		assert(message.GetWorldState() != nullptr);
+		assert(m_Order[s_SubtypeSlot]->first == m_SubtypeKey);
+		if (GetPrescribed<s_SubtypeSlot>().Get<std::string>() == event->Message().GetSubtype())
+		{
+			React(eventPub);
+		}
+	}
 
-		Datum* subtypeDatum = Find(m_SubtypeKey);
-		bool subtypeMatch = false;
+	void ReactionAttributed::NotifyBatch(const Vector<const EventPublisher*>& events)
+	{
+		for (const EventPublisher* eventPub : events)
+		{
+			assert(eventPub != nullptr);
+			React(*eventPub);
+		}
+	}
 
-		for (size_t i = 0; i < subtypeDatum->Size(); ++i)
+	Key ReactionAttributed::RouteKey() const
+	{
+		const std::string& subtype = GetSubtype();
+		if (m_Route.IsNull() || m_Route.Name() != subtype)
 		{
-			if (subtypeDatum->Get<std::string>(i) == message.GetSubtype())
-			{
-				subtypeMatch = true;
-				break;
-			}
+			m_Route = Key(subtype);
 		}
 
-		if (subtypeMatch)
+		return m_Route;
+	}
+
+	void ReactionAttributed::React(const EventPublisher& eventPub)
+	{
+		const Event<EventMessageAttributed>* event = eventPub.As<Event<EventMessageAttributed>>();
+
+		if (event == nullptr)
 		{
-			for (auto& pair : message.AuxiliaryAttributes())
-			{
-				Datum& datum = AppendAuxiliaryAttribute(pair->first);
-				datum = pair->second;
-			}
+			throw std::runtime_error("Event must be of type EventMessageAttributed");
+		}
+
+		const EventMessageAttributed& message = event->Message();
+
+		assert(message.GetWorldState() != nullptr);
 
-			ActionList::Update(*message.GetWorldState());
+		for (auto& pair : message.AuxiliaryAttributes())
+		{
+			Datum& datum = AppendAuxiliaryAttribute(pair->first);
+			datum = pair->second;
 		}
+
+		ActionList::Update(*message.GetWorldState());
 	}
 
 	ReactionAttributed::~ReactionAttributed()
@@ -6,7 +6,7 @@ namespace FieaGameEngine
 {
 	/// <summary>
 	/// ReactionAttributed class
-	/// subscribes to Event<EventMessageAttribute>
+	/// subscribes to Event<EventMessageAttribute>, routed by its subtype so it only hears messages it wants
 	/// WILL FAIL if it is subscribed to another kind of event
 	/// copies arguments into itself and then calls update upon notify
 	/// </summary>
@@ -17,7 +17,7 @@ namespace FieaGameEngine
 	public:
 		/// <summary>
 		/// ReactionAttributed constructor
-		/// subscribes to Event<EvetnMessageAttributed>
+		/// watches its subtype datum and subscribes to Event<EvetnMessageAttributed>
 		/// </summary>
 		ReactionAttributed();
 
@@ -28,24 +28,28 @@ namespace FieaGameEngine
 		~ReactionAttributed();
 
 		/// <summary>
-		/// default reaction attributed copy constructor
+		/// reaction attributed copy constructor
+		/// watches its own subtype datum, since datums don't copy being watched
 		/// </summary>
-		ReactionAttributed(const ReactionAttributed&) = default;
+		ReactionAttributed(const ReactionAttributed& other);
 
 		/// <summary>
-		/// default reaction attributed move constructor
+		/// reaction attributed move constructor
+		/// watches its own subtype datum, since datums don't copy being watched
 		/// </summary>
-		ReactionAttributed(ReactionAttributed&&) = default;
+		ReactionAttributed(ReactionAttributed&& other) noexcept;
 
 		/// <summary>
-		/// default reaction attributed copy assignemnt operator
+		/// reaction attributed copy assignemnt operator
+		/// takes on the other's subtype, so it calls RoutesChanged
 		/// </summary>
-		ReactionAttributed& operator=(const ReactionAttributed&) = default;
+		ReactionAttributed& operator=(const ReactionAttributed& other);
 
 		/// <summary>
-		/// default reaction attributed move assignemnt operator
+		/// reaction attributed move assignemnt operator
+		/// takes on the other's subtype, so it calls RoutesChanged
 		/// </summary>
-		ReactionAttributed& operator=(ReactionAttributed&&) = default;
+		ReactionAttributed& operator=(ReactionAttributed&& other) noexcept;
 
 		/// <summary>
 		/// checks the messages subtype against its own subtype(s)
@@ -54,6 +58,21 @@ namespace FieaGameEngine
 		/// <param name="eventPub">the event that notified us</param>
 		void Notify(const EventPublisher& eventPub) override;
 
+		/// <summary>
+		/// copies the auxiliary attributes of each message into itself and calls action lists update, in order
+		/// the table only hands over the messages that match its subtype
+		/// </summary>
+		/// <param name="events">the events that notified us</param>
+		void NotifyBatch(const Vector<const EventPublisher*>& events) override;
+
+		/// <summary>
+		/// returns the interned key of its subtype, which the event table routes messages by
+		/// the subtype datum is watched, so setting it through SetSubtype or the datum reroutes it before the next delivery
+		/// only writing through the reference Get returns skips that, and has to be followed by a call to RoutesChanged
+		/// </summary>
+		/// <returns>the key of its subtype</returns>
+		Key RouteKey() const override;
+
 		/// <summary>
 		/// returns a heap allocated copy of itself
 		/// </summary>
@@ -67,27 +86,45 @@ namespace FieaGameEngine
 		const std::string& GetSubtype() const;
 		
 		/// <summary>
-		/// sets the subtype it processes to the passed in value
+		/// sets the subtype it processes to the passed in value, it is rerouted before the next delivery
 		/// </summary>
 		/// <param name="subtype">the subtype to set</param>
 		void SetSubtype(const std::string& subtype);
 
 		/// <summary>
 		/// returns a vecotor of its prescribed attribute signatures
+		/// actionlist's signatures come first so its slots line up with this type's
 		/// </summary>
 		/// <returns>the vector of its signatures</returns>
 		static const Vector<Signature> Signatures();
 
+		/// <summary>
+		/// the slot of m_Subtype, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_SubtypeSlot = 3;
+
 	protected:
+		/// <summary>
+		/// copies the message's auxiliary attributes into itself and calls action lists update
+		/// </summary>
+		/// <param name="eventPub">the event that notified us</param>
+		void React(const EventPublisher& eventPub);
+
 		/// <summary>
 		/// the subtype that it processes
+		/// only read through its datum, since it isn't used when the type is stored in columns
 		/// </summary>
 		std::string m_Subtype;
 
+		/// <summary>
+		/// the key of m_Subtype as of the last time it was routed, remade whenever the subtype changes
+		/// </summary>
+		mutable Key m_Route;
+
 		/// <summary>
 		/// the key that is used for the subtype datum
 		/// </summary>
-		inline static const std::string m_SubtypeKey = "m_Subtype";
+		inline static const Key m_SubtypeKey{ "m_Subtype" };
 	};
 
 	ConcreteFactory(ReactionAttributed, Scope);
@@ -0,0 +1,55 @@
+#include "pch.h"
+#include "ResolvedRef.h"
+
+namespace FieaGameEngine
+{
+	std::pair<Datum*, Scope*> ResolvedRef::Resolve(Scope& scope, const Key& key)
+	{
+		if (!IsCurrent(scope, key))
+		{
+			Reset();
+			m_Key = key;
+
+			for (Scope* current = &scope; current != nullptr; current = current->GetParent())
+			{
+				m_Path.PushBack(Stamp{ current, current->Version() });
+
+				Datum* datum = current->Find(key);
+				if (datum != nullptr)
+				{
+					m_Datum = datum;
+					m_Scope = current;
+					break;
+				}
+			}
+		}
+
+		return std::make_pair(m_Datum, m_Scope);
+	}
+
+	bool ResolvedRef::IsCurrent(const Scope& scope, const Key& key) const
+	{
+		if (m_Path.IsEmpty() || m_Key != key || m_Path.Front().m_Scope != &scope)
+		{
+			return false;
+		}
+
+		for (const Stamp& stamp : m_Path)
+		{
+			if (stamp.m_Scope->Version() != stamp.m_Version)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void ResolvedRef::Reset()
+	{
+		m_Path.Clear();
+		m_Key = Key();
+		m_Datum = nullptr;
+		m_Scope = nullptr;
+	}
+}
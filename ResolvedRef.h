@@ -0,0 +1,79 @@
+#pragma once
+#include <cstdint>
+#include "Scope.h"
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// ResolvedRef class
+	/// remembers the result of searching up the hierarchy for a key, so the same search can be repeated without hashing
+	/// it keeps the version of every scope the search looked in, from the first scope up to the one the key was found in,
+	/// and reuses the result for as long as none of those versions change
+	/// the scope the search starts from has to outlive the ref, which is why the ref is usually a member of that scope
+	/// </summary>
+	class ResolvedRef final
+	{
+	public:
+		/// <summary>
+		/// searches up the hierarchy for a key, the same as Scope::Search
+		/// if the last search was from the same scope for the same key and nothing it looked at has changed, its result is returned
+		/// instead, for the cost of comparing one version per scope
+		/// </summary>
+		/// <param name="scope">the scope to start from</param>
+		/// <param name="key">the key to be found</param>
+		/// <returns>the datum that was found and the scope it was found in, or two nullptrs if not found</returns>
+		std::pair<Datum*, Scope*> Resolve(Scope& scope, const Key& key);
+
+		/// <summary>
+		/// returns whether or not the last search can be reused
+		/// </summary>
+		/// <param name="scope">the scope to start from</param>
+		/// <param name="key">the key to be found</param>
+		/// <returns>whether or not the last search was from that scope for that key, and nothing it looked at has changed</returns>
+		bool IsCurrent(const Scope& scope, const Key& key) const;
+
+		/// <summary>
+		/// forgets the last search, so the next one can't reuse it
+		/// </summary>
+		void Reset();
+
+	private:
+		/// <summary>
+		/// one scope the search looked in, and its version at the time
+		/// </summary>
+		struct Stamp final
+		{
+			/// <summary>
+			/// the scope
+			/// </summary>
+			const Scope* m_Scope;
+
+			/// <summary>
+			/// its version when it was searched
+			/// </summary>
+			std::uint64_t m_Version;
+		};
+
+		/// <summary>
+		/// the scopes the last search looked in, from the first up to the one the key was found in
+		/// each is only looked at once the one before it is known to be unchanged, which means it is still that scope's parent
+		/// </summary>
+		Vector<Stamp> m_Path;
+
+		/// <summary>
+		/// the key the last search was for
+		/// </summary>
+		Key m_Key;
+
+		/// <summary>
+		/// the datum the last search found, nullptr if it found nothing
+		/// </summary>
+		Datum* m_Datum = nullptr;
+
+		/// <summary>
+		/// the scope the last search found the key in, nullptr if it found nothing
+		/// </summary>
+		Scope* m_Scope = nullptr;
+	};
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include "NodeAllocator.h"
 
 namespace FieaGameEngine 
 {
@@ -6,7 +7,9 @@ namespace FieaGameEngine
 	/// SList class
 	/// Holds a series of nodes containing a data type that point to another node in the list, starting with the head and ending with the tail
 	/// </summary>
-	template <typename T>
+	/// <typeparam name="T">the type stored in the list</typeparam>
+	/// <typeparam name="TAllocator">where the nodes come from, see NodeAllocator.h</typeparam>
+	template <typename T, typename TAllocator = PooledNodeAllocator>
 	class SList
 	{
 	private:
@@ -454,20 +457,34 @@ namespace FieaGameEngine
 		bool Remove(const Iterator& it);
 
 	private:
+		/// <summary>
+		/// makes a node out of memory from the allocator
+		/// </summary>
+		/// <param name="args">the arguments for the node's constructor</param>
+		/// <returns>the new node</returns>
+		template <typename... Args>
+		static Node* CreateNode(Args&&... args);
+
+		/// <summary>
+		/// destroys a node and gives its memory back to the allocator
+		/// </summary>
+		/// <param name="node">the node to be destroyed</param>
+		static void DestroyNode(Node* node);
+
 		/// <summary>
 		/// the first node of the list
 		/// </summary>
-		Node* m_Head;
+		Node* m_Head = nullptr;
 
 		/// <summary>
 		/// the last node of the list
 		/// </summary>
-		Node* m_Tail;
+		Node* m_Tail = nullptr;
 
 		/// <summary>
 		/// the size of the list
 		/// </summary>
-		size_t m_Size;
+		size_t m_Size = 0;
 	};
 }
 
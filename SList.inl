@@ -3,11 +3,11 @@
 namespace FieaGameEngine 
 {
 #pragma region SList
-	template<typename T>
-	inline SList<T>::SList() : m_Head(nullptr), m_Tail(nullptr), m_Size(0) {}
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>::SList() : m_Head(nullptr), m_Tail(nullptr), m_Size(0) {}
 
-	template<typename T>
-	inline SList<T>::SList(const SList& ToCopy)
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>::SList(const SList& ToCopy)
 	{
 		for (const T& value : ToCopy)
 		{
@@ -15,8 +15,8 @@ namespace FieaGameEngine
 		}
 	}
 
-	template<typename T>
-	inline SList<T>::SList(SList&& ToMove) noexcept : 
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>::SList(SList&& ToMove) noexcept : 
 		m_Head(ToMove.m_Head), m_Tail(ToMove.m_Tail), m_Size(ToMove.m_Size)
 	{
 		ToMove.m_Head = nullptr;
@@ -24,8 +24,8 @@ namespace FieaGameEngine
 		ToMove.m_Size = size_t(0);
 	}
 
-	template<typename T>
-	inline SList<T>& SList<T>::operator=(const SList& ToCopy)
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>& SList<T, TAllocator>::operator=(const SList& ToCopy)
 	{
 		if (this != &ToCopy)
 		{
@@ -39,8 +39,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	inline SList<T>& SList<T>::operator=(SList&& ToMove) noexcept
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>& SList<T, TAllocator>::operator=(SList&& ToMove) noexcept
 	{
 		if (this != &ToMove)
 		{
@@ -58,8 +58,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	inline T& SList<T>::Front()
+	template<typename T, typename TAllocator>
+	inline T& SList<T, TAllocator>::Front()
 	{
 		if (m_Head == nullptr)
 		{
@@ -69,8 +69,8 @@ namespace FieaGameEngine
 		return m_Head->m_NodeValue;
 	}
 
-	template<typename T>
-	inline const T& SList<T>::Front() const
+	template<typename T, typename TAllocator>
+	inline const T& SList<T, TAllocator>::Front() const
 	{
 		if (m_Head == nullptr)
 		{
@@ -80,8 +80,8 @@ namespace FieaGameEngine
 		return m_Head->m_NodeValue;
 	}
 
-	template<typename T>
-	inline T& SList<T>::Back()
+	template<typename T, typename TAllocator>
+	inline T& SList<T, TAllocator>::Back()
 	{
 		if (m_Tail == nullptr)
 		{
@@ -90,8 +90,8 @@ namespace FieaGameEngine
 		return m_Tail->m_NodeValue;
 	}
 
-	template<typename T>
-	inline const T& SList<T>::Back() const
+	template<typename T, typename TAllocator>
+	inline const T& SList<T, TAllocator>::Back() const
 	{
 		if (m_Tail == nullptr)
 		{
@@ -100,10 +100,10 @@ namespace FieaGameEngine
 		return m_Tail->m_NodeValue;
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::PushFront(const T& ToPush)
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::PushFront(const T& ToPush)
 	{
-		m_Head = new Node(ToPush, m_Head);
+		m_Head = CreateNode(ToPush, m_Head);
 		m_Size++;
 
 		if (m_Tail == nullptr)
@@ -114,8 +114,8 @@ namespace FieaGameEngine
 		return begin();
 	}
 
-	template<typename T>
-	inline void SList<T>::PopFront()
+	template<typename T, typename TAllocator>
+	inline void SList<T, TAllocator>::PopFront()
 	{
 		if (m_Head != nullptr)
 		{
@@ -127,17 +127,17 @@ namespace FieaGameEngine
 				m_Tail = nullptr;
 			}
 
-			delete PoppedNode;
+			DestroyNode(PoppedNode);
 			m_Size--;
 		}
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::PushBack(const T& ToPush)
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::PushBack(const T& ToPush)
 	{
 		Node* CurrentTail = m_Tail;
 
-		m_Tail = new Node(ToPush);
+		m_Tail = CreateNode(ToPush);
 		m_Size++;
 
 		if (CurrentTail == nullptr)
@@ -151,12 +151,12 @@ namespace FieaGameEngine
 		
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::PushBack(T&& ToPush)
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::PushBack(T&& ToPush)
 	{
 		Node* CurrentTail = m_Tail;
 
-		m_Tail = new Node(std::move(ToPush));
+		m_Tail = CreateNode(std::move(ToPush));
 		m_Size++;
 
 		if (CurrentTail == nullptr)
@@ -170,8 +170,8 @@ namespace FieaGameEngine
 
 	}
 
-	template<typename T>
-	inline void SList<T>::PopBack()
+	template<typename T, typename TAllocator>
+	inline void SList<T, TAllocator>::PopBack()
 	{
 		if (m_Tail != nullptr)
 		{
@@ -194,25 +194,25 @@ namespace FieaGameEngine
 				m_Tail = nullptr;
 			}
 
-			delete PoppedNode;
+			DestroyNode(PoppedNode);
 			m_Size--;
 		}
 	}
 
-	template<typename T>
-	inline size_t SList<T>::Size() const
+	template<typename T, typename TAllocator>
+	inline size_t SList<T, TAllocator>::Size() const
 	{
 		return m_Size;
 	}
 
-	template<typename T>
-	inline bool SList<T>::IsEmpty() const
+	template<typename T, typename TAllocator>
+	inline bool SList<T, TAllocator>::IsEmpty() const
 	{
 		return (m_Head == nullptr);
 	}
 
-	template<typename T>
-	inline void SList<T>::Clear()
+	template<typename T, typename TAllocator>
+	inline void SList<T, TAllocator>::Clear()
 	{
 		while (m_Head != nullptr)
 		{
@@ -220,45 +220,45 @@ namespace FieaGameEngine
 		}
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::begin()
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::begin()
 	{
 		return Iterator(*this, m_Head);
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::end()
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::end()
 	{
 		return Iterator(*this, nullptr);
 	}
 
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::begin() const
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::ConstIterator SList<T, TAllocator>::begin() const
 	{
 		return ConstIterator(*this, m_Head);
 	}
 
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::end() const
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::ConstIterator SList<T, TAllocator>::end() const
 	{
 		return ConstIterator(*this, nullptr);
 	}
 
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::cbegin() const
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::ConstIterator SList<T, TAllocator>::cbegin() const
 	{
 		return ConstIterator(*this, m_Head);
 	}
 
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::cend() const
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::ConstIterator SList<T, TAllocator>::cend() const
 	{
 		return ConstIterator(*this, nullptr);
 	}
 
-	template<typename T>
+	template<typename T, typename TAllocator>
 	template<typename EqualityFunctor>
-	inline typename SList<T>::Iterator SList<T>::Find(const T& value)
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::Find(const T& value)
 	{
 		EqualityFunctor eq;
 		Iterator it = begin();
@@ -273,9 +273,9 @@ namespace FieaGameEngine
 		return it;
 	}
 
-	template<typename T>
+	template<typename T, typename TAllocator>
 	template<typename EqualityFunctor>
-	inline typename SList<T>::ConstIterator SList<T>::Find(const T& value) const
+	inline typename SList<T, TAllocator>::ConstIterator SList<T, TAllocator>::Find(const T& value) const
 	{
 		EqualityFunctor eq;
 		ConstIterator it = begin();
@@ -290,8 +290,8 @@ namespace FieaGameEngine
 		return it;
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::InsertAfter(Iterator& it, const T& value)
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::InsertAfter(Iterator& it, const T& value)
 	{
 		if (it.m_Owner == nullptr)
 		{
@@ -305,16 +305,22 @@ namespace FieaGameEngine
 		}
 		
 		Node* Next = it.m_Node->m_NextNode;
-		it.m_Node->m_NextNode = new Node(value, Next);
+		it.m_Node->m_NextNode = CreateNode(value, Next);
 		m_Size++;
+
+		if (Next == nullptr)
+		{
+			m_Tail = it.m_Node->m_NextNode;
+		}
+
 		++it;
 		return it;
 		
 	}
 
-	template<typename T>
+	template<typename T, typename TAllocator>
 	template <typename EqualityFunctor>
-	inline bool SList<T>::Remove(const T& value)
+	inline bool SList<T, TAllocator>::Remove(const T& value)
 	{
 		Iterator it = Find<EqualityFunctor>(value);
 
@@ -326,8 +332,8 @@ namespace FieaGameEngine
 		return false;
 	}
 
-	template<typename T>
-	inline bool SList<T>::Remove(const Iterator& it)
+	template<typename T, typename TAllocator>
+	inline bool SList<T, TAllocator>::Remove(const Iterator& it)
 	{
 		if (it.m_Node != nullptr)
 		{
@@ -342,7 +348,7 @@ namespace FieaGameEngine
 				{
 					m_Tail = it.m_Node;
 				}
-				delete Next;
+				DestroyNode(Next);
 				--m_Size;
 			}
 			else
@@ -356,44 +362,68 @@ namespace FieaGameEngine
 	}
 
 
-	template <typename T>
-	inline SList<T>::~SList()
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>::~SList()
 	{
 		Clear();
 	}
 
+	template<typename T, typename TAllocator>
+	template<typename... Args>
+	inline typename SList<T, TAllocator>::Node* SList<T, TAllocator>::CreateNode(Args&&... args)
+	{
+		void* memory = TAllocator::Allocate(sizeof(Node));
+
+		try
+		{
+			return new(memory) Node(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			TAllocator::Deallocate(memory, sizeof(Node));
+			throw;
+		}
+	}
+
+	template<typename T, typename TAllocator>
+	inline void SList<T, TAllocator>::DestroyNode(Node* node)
+	{
+		node->~Node();
+		TAllocator::Deallocate(node, sizeof(Node));
+	}
+
 #pragma endregion SList
 
 	
 
 #pragma region Node
-	template<typename T>
-	inline SList<T>::Node::Node(const T& value, Node* next) : m_NodeValue(value), m_NextNode(next) {}
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>::Node::Node(const T& value, Node* next) : m_NodeValue(value), m_NextNode(next) {}
 
-	template<typename T>
-	inline SList<T>::Node::Node(T&& value, Node* next) : m_NodeValue(value), m_NextNode(next) {}
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>::Node::Node(T&& value, Node* next) : m_NodeValue(std::move(value)), m_NextNode(next) {}
 
 
 #pragma region Iterator
 
-	template <typename T>
-	inline SList<T>::Iterator::Iterator(const SList& owner, Node* node) : 
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>::Iterator::Iterator(const SList& owner, Node* node) : 
 		m_Node(node), m_Owner(&owner) { }
 
-	template <typename T>
-	inline bool SList<T>::Iterator::operator==(const Iterator& other) const
+	template<typename T, typename TAllocator>
+	inline bool SList<T, TAllocator>::Iterator::operator==(const Iterator& other) const
 	{
 		return !(operator!=(other));
 	}
 
-	template <typename T>
-	inline bool SList<T>::Iterator::operator!=(const Iterator& other) const
+	template<typename T, typename TAllocator>
+	inline bool SList<T, TAllocator>::Iterator::operator!=(const Iterator& other) const
 	{
 		return m_Owner != other.m_Owner || m_Node != other.m_Node;
 	}
 
-	template <typename T>
-	inline typename SList<T>::Iterator& SList<T>::Iterator::operator++()
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator& SList<T, TAllocator>::Iterator::operator++()
 	{
 		if (m_Owner == nullptr)
 		{
@@ -407,8 +437,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T>
-	inline typename SList<T>::Iterator& SList<T>::Iterator::operator++(int)
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator& SList<T, TAllocator>::Iterator::operator++(int)
 	{
 		Iterator& temp(*this);
 		operator++();
@@ -416,8 +446,8 @@ namespace FieaGameEngine
 		return temp;
 	}
 
-	template <typename T>
-	inline T& SList<T>::Iterator::operator*() const
+	template<typename T, typename TAllocator>
+	inline T& SList<T, TAllocator>::Iterator::operator*() const
 	{
 		if (m_Node == nullptr)
 		{
@@ -431,28 +461,28 @@ namespace FieaGameEngine
 
 #pragma region ConstIterator
 
-	template <typename T>
-	inline SList<T>::ConstIterator::ConstIterator(const SList& owner, Node* node) :
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>::ConstIterator::ConstIterator(const SList& owner, Node* node) :
 		m_Node(node), m_Owner(&owner) { }
 
-	template <typename T>
-	inline SList<T>::ConstIterator::ConstIterator(const Iterator& other) :
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>::ConstIterator::ConstIterator(const Iterator& other) :
 		m_Node(other.m_Node), m_Owner(other.m_Owner) { }
 
-	template <typename T>
-	inline bool SList<T>::ConstIterator::operator==(const ConstIterator& other) const
+	template<typename T, typename TAllocator>
+	inline bool SList<T, TAllocator>::ConstIterator::operator==(const ConstIterator& other) const
 	{
 		return !(operator!=(other));
 	}
 
-	template <typename T>
-	inline bool SList<T>::ConstIterator::operator!=(const ConstIterator& other) const
+	template<typename T, typename TAllocator>
+	inline bool SList<T, TAllocator>::ConstIterator::operator!=(const ConstIterator& other) const
 	{
 		return m_Owner != other.m_Owner || m_Node != other.m_Node;
 	}
 
-	template <typename T>
-	inline typename SList<T>::ConstIterator& SList<T>::ConstIterator::operator++()
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::ConstIterator& SList<T, TAllocator>::ConstIterator::operator++()
 	{
 		if (m_Owner == nullptr)
 		{
@@ -467,8 +497,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T>
-	inline typename SList<T>::ConstIterator& SList<T>::ConstIterator::operator++(int)
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::ConstIterator& SList<T, TAllocator>::ConstIterator::operator++(int)
 	{
 		ConstIterator& temp(*this);
 		operator++();
@@ -476,8 +506,8 @@ namespace FieaGameEngine
 		return temp;
 	}
 
-	template <typename T>
-	inline const T& SList<T>::ConstIterator::operator*() const
+	template<typename T, typename TAllocator>
+	inline const T& SList<T, TAllocator>::ConstIterator::operator*() const
 	{
 		if (m_Node == nullptr)
 		{
@@ -1,10 +1,17 @@
 #include "pch.h"
 #include "Scope.h"
+#include "SlabAllocator.h"
 
 namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(Scope);
 
+	//scopes and the table nodes holding their datums come out of slab blocks, which are only aligned to the granularity
+	static_assert(alignof(Scope) <= SlabAllocator::s_Granularity, "Scope is over aligned for the slab allocator");
+	static_assert(alignof(Datum) <= SlabAllocator::s_Granularity, "Datum is over aligned for the slab allocator");
+
+	static const Key s_ThisKey("this");
+
 	Scope::Scope(size_t size) : m_Map(size), m_Order(size) {}
 
 	Scope::Scope(const Scope& toCopy)
@@ -20,8 +27,7 @@ namespace FieaGameEngine
 				for (size_t i = 0; i < copyDatum.Size(); ++i)
 				{
 					Scope* scope = copyDatum.Get<Scope>(i).Clone();
-					scope->m_Parent = this;
-					datum.PushBack(*scope);
+					PushChild(datum, *scope);
 				}
 			}
 			else
@@ -46,16 +52,23 @@ namespace FieaGameEngine
 				{
 					Scope& scope = datum.Get<Scope>(i);
 					scope.m_Parent = this;
+					scope.m_ParentDatum = &datum;
+					scope.m_ParentIndex = i;
+					scope.ChangeStructure();
 				}
 			}
 		}
 
 		if (m_Parent != nullptr)
 		{
-			auto [parentDatum, index] = m_Parent->FindContainedScope(toMove);
-			parentDatum->Set(*this, index);
+			m_ParentDatum = toMove.m_ParentDatum;
+			m_ParentIndex = toMove.m_ParentIndex;
+			m_ParentDatum->Set(*this, m_ParentIndex);
 			toMove.m_Parent = nullptr;
+			toMove.m_ParentDatum = nullptr;
 		}
+
+		toMove.ChangeStructure();
 	}
 
 	Scope& Scope::operator=(const Scope& toCopy)
@@ -75,8 +88,7 @@ namespace FieaGameEngine
 					for (size_t i = 0; i < copyDatum.Size(); ++i)
 					{
 						Scope* scope = copyDatum.Get<Scope>(i).Clone();
-						scope->m_Parent = this;
-						datum.PushBack(*scope);
+						PushChild(datum, *scope);
 					}
 				}
 				else
@@ -109,16 +121,24 @@ namespace FieaGameEngine
 					{
 						Scope& scope = datum.Get<Scope>(i);
 						scope.m_Parent = this;
+						scope.m_ParentDatum = &datum;
+						scope.m_ParentIndex = i;
+						scope.ChangeStructure();
 					}
 				}
 			}
 
 			if (m_Parent != nullptr)
 			{
-				auto [parentDatum, index] = m_Parent->FindContainedScope(toMove);
-				parentDatum->Set(*this, index);
+				m_ParentDatum = toMove.m_ParentDatum;
+				m_ParentIndex = toMove.m_ParentIndex;
+				m_ParentDatum->Set(*this, m_ParentIndex);
 				toMove.m_Parent = nullptr;
+				toMove.m_ParentDatum = nullptr;
 			}
+
+			ChangeStructure();
+			toMove.ChangeStructure();
 		}
 
 		return *this;
@@ -165,7 +185,7 @@ namespace FieaGameEngine
 			{
 				const Datum* compareDatum = toCompare->Find(it->first);
 
-				if (it->first != "this")
+				if (it->first != s_ThisKey)
 				{
 					if (compareDatum != nullptr)
 					{
@@ -195,11 +215,19 @@ namespace FieaGameEngine
 	{
 		EmptyStringCheck(key);
 
+		return Append(Key(key));
+	}
+
+	Datum& Scope::Append(const Key& key)
+	{
+		EmptyStringCheck(key.Name());
+
 		auto [it, inserted] = m_Map.Insert(make_pair(key, Datum()));
 
 		if (inserted)
 		{
 			m_Order.PushBack(&(*it));
+			ChangeStructure();
 		}
 
 		return it->second;
@@ -217,8 +245,7 @@ namespace FieaGameEngine
 		}
 		
 		Scope* scope = new Scope();
-		scope->m_Parent = this;
-		datum.PushBack(*scope);
+		PushChild(datum, *scope);
 		return *scope;
 	}
 
@@ -226,6 +253,13 @@ namespace FieaGameEngine
 	{
 		EmptyStringCheck(key);
 
+		Adopt(toAdopt, Key(key));
+	}
+
+	void Scope::Adopt(Scope& toAdopt, const Key& key)
+	{
+		EmptyStringCheck(key.Name());
+
 		if (IsDescendantOf(toAdopt))
 		{
 			throw std::runtime_error("Cannot adopt your anscestor");
@@ -244,19 +278,111 @@ namespace FieaGameEngine
 		}
 
 		toAdopt.Orphan();
-		toAdopt.m_Parent = this;
-		datum.PushBack(toAdopt);
+		PushChild(datum, toAdopt);
+		toAdopt.ChangeStructure();
 	}
 
 	void Scope::Orphan()
 	{
 		if (m_Parent != nullptr)
 		{
-			auto [datum, index] = m_Parent->FindContainedScope(*this);
+			Datum& datum = *m_ParentDatum;
+			assert(&datum.Get<Scope>(m_ParentIndex) == this);
+
+			m_Parent = nullptr;
+			m_ParentDatum = nullptr;
+
+			//shifts the scopes after it down and gives them their new indices
+			datum.RemoveAt(m_ParentIndex);
+			ChangeStructure();
+		}
+	}
+
+	void Scope::OrphanUnordered()
+	{
+		if (m_Parent != nullptr)
+		{
+			Datum& datum = *m_ParentDatum;
+			size_t last = datum.Size() - 1;
+			assert(&datum.Get<Scope>(m_ParentIndex) == this);
 
-			datum->RemoveAt(index);
+			//swap places with the last scope in the table so nothing has to shift down
+			if (m_ParentIndex != last)
+			{
+				Scope& moved = datum.Get<Scope>(last);
+				moved.m_ParentIndex = m_ParentIndex;
+				datum.Set(moved, m_ParentIndex);
+
+				m_ParentIndex = last;
+				datum.Set(*this, last);
+			}
 
 			m_Parent = nullptr;
+			m_ParentDatum = nullptr;
+			datum.PopBack();
+			ChangeStructure();
+		}
+	}
+
+	void Scope::Absorb(Scope& donor)
+	{
+		for (MapPairType* pair : donor.m_Order)
+		{
+			Datum& source = pair->second;
+
+			if (source.Type() == Datum::DatumTypes::TABLE)
+			{
+				Datum& destination = Append(pair->first);
+				if (destination.Type() != Datum::DatumTypes::TABLE && destination.Type() != Datum::DatumTypes::UNKNOWN)
+				{
+					throw std::runtime_error("Datum at this key is not of type table");
+				}
+				destination.SetType(Datum::DatumTypes::TABLE);
+
+				//taken over in one pass instead of adopted one at a time, since orphaning each from the front would shift the rest down every time
+				for (size_t i = 0; i < source.Size(); ++i)
+				{
+					Scope& child = source.Get<Scope>(i);
+					child.m_Parent = nullptr;
+					PushChild(destination, child);
+					child.ChangeStructure();
+				}
+				source.Clear();
+				continue;
+			}
+
+			Datum& destination = Append(pair->first);
+			if (destination.Type() == Datum::DatumTypes::UNKNOWN)
+			{
+				destination.SetType(source.Type());
+			}
+
+			for (size_t i = 0; i < source.Size(); ++i)
+			{
+				switch (source.Type())
+				{
+				case Datum::DatumTypes::INTEGER:
+					destination.PushBack(source.Get<int>(i));
+					break;
+				case Datum::DatumTypes::FLOAT:
+					destination.PushBack(source.Get<float>(i));
+					break;
+				case Datum::DatumTypes::STRING:
+					destination.PushBack(source.Get<std::string>(i));
+					break;
+				case Datum::DatumTypes::VECTOR:
+					destination.PushBack(source.Get<glm::vec4>(i));
+					break;
+				case Datum::DatumTypes::MATRIX:
+					destination.PushBack(source.Get<glm::mat4>(i));
+					break;
+				case Datum::DatumTypes::POINTER:
+					destination.PushBack(source.Get<RTTI*>(i));
+					break;
+				default:
+					break;
+				}
+			}
 		}
 	}
 
@@ -266,6 +392,18 @@ namespace FieaGameEngine
 	}
 
 	const Datum* Scope::Find(KeyType& key) const 
+	{
+		Key interned = Key::Find(key);
+		return interned.IsNull() ? nullptr : Find(interned);
+	}
+
+	Datum* Scope::Find(KeyType& key)
+	{
+		Key interned = Key::Find(key);
+		return interned.IsNull() ? nullptr : Find(interned);
+	}
+
+	const Datum* Scope::Find(const Key& key) const
 	{
 		auto it = m_Map.Find(key);
 		if (it == m_Map.end())
@@ -276,7 +414,7 @@ namespace FieaGameEngine
 		return &(it->second);
 	}
 
-	Datum* Scope::Find(KeyType& key)
+	Datum* Scope::Find(const Key& key)
 	{
 		auto it = m_Map.Find(key);
 		if (it == m_Map.end())
@@ -289,32 +427,26 @@ namespace FieaGameEngine
 
 	std::pair<Datum*, size_t> Scope::FindContainedScope(Scope& toFind)
 	{
-		for (auto it = m_Map.begin(); it != m_Map.end(); ++it)
+		if (toFind.m_Parent == this)
 		{
-			Datum& currentDatum = it->second;
-			if (currentDatum.Type() == Datum::DatumTypes::TABLE)
-			{
-				size_t index = 0; 
-
-				for (index; index < currentDatum.Size(); ++index)
-				{
-					if (&(currentDatum.Get<Scope>(index)) == &toFind)
-					{
-						break;
-					}
-				}
-
-				if (index != currentDatum.Size())
-				{
-					return make_pair(&currentDatum, index);
-				}
-			}
+			return make_pair(toFind.m_ParentDatum, toFind.m_ParentIndex);
 		}
 
 		return make_pair(nullptr, 0);
 	}
 
 	std::pair<Datum*, Scope*> Scope::Search(KeyType& key)
+	{
+		Key interned = Key::Find(key);
+		if (interned.IsNull())
+		{
+			return std::make_pair(nullptr, nullptr);
+		}
+
+		return Search(interned);
+	}
+
+	std::pair<Datum*, Scope*> Scope::Search(const Key& key)
 	{
 		Datum* datum = Find(key);
 		Scope* scope = this;
@@ -336,6 +468,21 @@ namespace FieaGameEngine
 		return m_Parent;
 	}
 
+	std::uint64_t Scope::Version() const
+	{
+		return m_Version;
+	}
+
+	void Scope::ChangeStructure()
+	{
+		m_Version = NextVersion();
+	}
+
+	std::uint64_t Scope::NextVersion()
+	{
+		return s_LastVersion.fetch_add(1, std::memory_order_relaxed) + 1;
+	}
+
 	void Scope::EmptyStringCheck(KeyType& key)
 	{
 		if (key.empty())
@@ -344,6 +491,28 @@ namespace FieaGameEngine
 		}
 	}
 
+	void Scope::PushChild(Datum& datum, Scope& child)
+	{
+		assert(child.m_Parent == nullptr);
+
+		datum.PushBack(child);
+		child.m_Parent = this;
+		child.m_ParentDatum = &datum;
+		child.m_ParentIndex = datum.Size() - 1;
+	}
+
+	void Scope::DeleteChildren(Datum& datum)
+	{
+		for (size_t i = 0; i < datum.Size(); ++i)
+		{
+			Scope* toDelete = &(datum.Get<Scope>(i));
+
+			//they're all going, so none of them needs to take itself out of the table
+			toDelete->m_Parent = nullptr;
+			delete toDelete;
+		}
+	}
+
 	bool Scope::IsDescendantOf(Scope& toCheck)
 	{
 		if (&toCheck == m_Parent)
@@ -364,23 +533,49 @@ namespace FieaGameEngine
 		Orphan();
 		for (auto it = m_Order.begin(); it != m_Order.end(); ++it)
 		{
-			Datum datum = (*it)->second;
+			Datum& datum = (*it)->second;
 			if (datum.Type() == Datum::DatumTypes::TABLE)
 			{
-				for (size_t i = 0; i < datum.Size(); ++i)
-				{
-					Scope* toDelete = &(datum.Get<Scope>(i));
-					delete toDelete;
-				}
+				DeleteChildren(datum);
 			}
 		}
 
 		m_Map.Clear();
 		m_Order.Clear();
+		ChangeStructure();
+	}
+
+	void Scope::Truncate(size_t size)
+	{
+		while (m_Order.Size() > size)
+		{
+			MapPairType* pair = m_Order.Back();
+
+			Datum& datum = pair->second;
+			if (datum.Type() == Datum::DatumTypes::TABLE)
+			{
+				DeleteChildren(datum);
+			}
+
+			Key key = pair->first;
+			m_Order.PopBack();
+			m_Map.Remove(key);
+			ChangeStructure();
+		}
 	}
 
 	Scope::~Scope()
 	{
 		Clear();
 	}
+
+	void* Scope::operator new(size_t size)
+	{
+		return SlabAllocator::Instance().Allocate(size);
+	}
+
+	void Scope::operator delete(void* pointer, size_t size)
+	{
+		SlabAllocator::Instance().Deallocate(pointer, size);
+	}
 }
\ No newline at end of file
@@ -1,23 +1,30 @@
 #pragma once
+#include <atomic>
+#include <cstdint>
 #include "HashMap.h"
 #include "Datum.h"
 #include "RTTI.h"
 #include "Factory.h"
+#include "Key.h"
 
 namespace FieaGameEngine
 {
 	/// <summary>
 	/// Scope class
 	/// stores a map of strings to datums, and also records the order of which they were inserted
+	/// the map is keyed on interned Keys, the string overloads intern or look up the string and forward to the Key ones
 	/// also is aware of who it's parent scope is, if any
 	/// </summary>
 	class Scope : public FieaGameEngine::RTTI
 	{
 		RTTI_DECLARATIONS(Scope, RTTI);
+		friend class Datum;
+		friend class ScopeSerializer;
+		friend class TableParseHelper;
 
 	public:
 		using KeyType = const std::string;
-		using MapType = HashMap<KeyType, Datum>;
+		using MapType = HashMap<const Key, Datum>;
 
 	protected:
 		using MapPairType = MapType::PairType;
@@ -130,6 +137,16 @@ namespace FieaGameEngine
 		/// <exception cref="runtime_error">throws an exception if the passed in string is empty</exception>
 		Datum& Append(KeyType& key);
 
+		/// <summary>
+		/// key version of append
+		/// adds a new datum to the scope based off the passed in key
+		/// if the key already exists, return the datum already present
+		/// </summary>
+		/// <param name="key">the key to be appended</param>
+		/// <returns>the datum associated the key, whether or not it was just created</returns>
+		/// <exception cref="runtime_error">throws an exception if the key is null or empty</exception>
+		Datum& Append(const Key& key);
+
 		/// <summary>
 		/// adds a new table datum based on the passed in key
 		/// heap allocates a new scope and pushes it back on the key 
@@ -149,11 +166,38 @@ namespace FieaGameEngine
 		/// <exception cref="rutime_error">throws an exception if the datum at the passed in key is not a table</exception>
 		void Adopt(Scope& toAdopt, KeyType& key);
 
+		/// <summary>
+		/// key version of adopt
+		/// takes in a scope and reparents it to this at a specific key
+		/// if it already has an owner, it calls orphan
+		/// </summary>
+		/// <param name="toAdopt">the scope to be adopted</param>
+		/// <param name="key">the key to put the scope at</param>
+		/// <exception cref="rutime_error">throws an exception if the datum at the passed in key is not a table</exception>
+		void Adopt(Scope& toAdopt, const Key& key);
+
 		/// <summary>
 		/// removes the scope from its parent
+		/// it knows where it is in its parent, so this doesn't scan, the scopes after it in the same table shift down
+		/// to keep their order, which is the order actions run and entities update in
 		/// </summary>
 		void Orphan();
 
+		/// <summary>
+		/// removes the scope from its parent in constant time, by moving the last scope in the same table into its place
+		/// only for tables whose order doesn't matter, since the scopes left in the table change order
+		/// </summary>
+		void OrphanUnordered();
+
+		/// <summary>
+		/// moves everything in another scope onto the end of this one, in the other scope's order
+		/// children are adopted instead of copied, and values at keys this already has are pushed onto the end of its datums,
+		/// the same as if they had been appended to this in the first place
+		/// </summary>
+		/// <param name="donor">the scope to take from, it is left without any children</param>
+		/// <exception cref="runtime_error">throws an exception if a datum here and in the donor have different types</exception>
+		void Absorb(Scope& donor);
+
 		/// <summary>
 		/// returns the size of the scope
 		/// </summary>
@@ -175,10 +219,27 @@ namespace FieaGameEngine
 		/// <returns>the key at the datum</returns>
 		Datum* Find(KeyType& key);
 
+		/// <summary>
+		/// key version of find
+		/// finds a certain datum based off the key, without touching the string
+		/// </summary>
+		/// <param name="key">the key to find the datum at</param>
+		/// <returns>the datum at the key, or nullptr if it is not there</returns>
+		const Datum* Find(const Key& key) const;
+
+		/// <summary>
+		/// non-const key version of find
+		/// finds a certain datum based off the key, without touching the string
+		/// </summary>
+		/// <param name="key">the key to find the datum at</param>
+		/// <returns>the datum at the key, or nullptr if it is not there</returns>
+		Datum* Find(const Key& key);
+
 		/// <summary>
 		/// finds a scope within itself or its children
 		/// does not search the parent(s)
 		/// returns nullptr and 0 if it is not found
+		/// every child knows where it is in its parent, so this doesn't scan
 		/// </summary>
 		/// <param name="toFind">the scope to be found</param>
 		/// <returns>the datum the scope is in and the index its at within said datum</returns>
@@ -192,18 +253,51 @@ namespace FieaGameEngine
 		/// <returns></returns>
 		std::pair<Datum*, Scope*> Search(KeyType& key);
 
+		/// <summary>
+		/// key version of search
+		/// searches up the hierarchy for a key
+		/// returns two nullptrs if not found
+		/// </summary>
+		/// <param name="key">the key to be found</param>
+		/// <returns>the datum that was found and the scope it was found in</returns>
+		std::pair<Datum*, Scope*> Search(const Key& key);
+
 		/// <summary>
 		/// returns the scopes parent scope, if any
 		/// </summary>
 		/// <returns>the scopes parent scope</returns>
 		Scope* GetParent();
 
+		/// <summary>
+		/// returns the scope's structural version, which changes whenever it gains or loses a key, or is adopted or orphaned
+		/// a search finds the same datum for as long as every scope it looked in keeps its version, see ResolvedRef
+		/// versions come from one counter shared by every scope, so a scope made where an old one was freed never has its version
+		/// </summary>
+		/// <returns>the current version, never 0</returns>
+		std::uint64_t Version() const;
+
 		/// <summary>
 		/// clears out the scope
 		/// deletes any children scope, and empties the map and the vector
 		/// </summary>
 		void Clear();
 
+		/// <summary>
+		/// allocates every scope, and everything derived from it, out of the shared slab allocator
+		/// building or cloning a big hierarchy makes lots of same sized objects, so this keeps them packed together
+		/// </summary>
+		/// <param name="size">the size of the object being made</param>
+		/// <returns>the memory for the object</returns>
+		static void* operator new(size_t size);
+
+		/// <summary>
+		/// gives a scope's memory back to the slab allocator
+		/// the destructor is virtual, so size is always the size of the most derived type
+		/// </summary>
+		/// <param name="pointer">the memory to be freed</param>
+		/// <param name="size">the size of the object being freed</param>
+		static void operator delete(void* pointer, size_t size);
+
 	protected:
 		/// <summary>
 		/// checks to see if this is a descendant of the passed in scope
@@ -212,6 +306,13 @@ namespace FieaGameEngine
 		/// <returns>whether or not we are descended from that </returns>
 		bool IsDescendantOf(Scope& toCheck);
 
+		/// <summary>
+		/// removes every pair from the given index on, newest first, deleting any children scopes they hold
+		/// the pairs before it, and the memory already set aside for the map and the vector, are kept
+		/// </summary>
+		/// <param name="size">the number of pairs to keep</param>
+		void Truncate(size_t size);
+
 		/// <summary>
 		/// helper functions that throws if a string is empty
 		/// </summary>
@@ -219,11 +320,46 @@ namespace FieaGameEngine
 		/// <exception cref="runtime_error">throws an exception if the string is empty</exception>
 		void EmptyStringCheck(KeyType& key);
 
+		/// <summary>
+		/// adds a scope to the end of a table in this scope and makes this its parent
+		/// </summary>
+		/// <param name="datum">the table to add to</param>
+		/// <param name="child">the scope to add, which must not have a parent</param>
+		void PushChild(Datum& datum, Scope& child);
+
+		/// <summary>
+		/// deletes every scope in a table without each one removing itself from the table first
+		/// </summary>
+		/// <param name="datum">the table whose scopes should be deleted</param>
+		static void DeleteChildren(Datum& datum);
+
+		/// <summary>
+		/// gives the scope a new version, for anything that could change what a search through it finds
+		/// </summary>
+		void ChangeStructure();
+
+		/// <summary>
+		/// returns a version no scope has had yet
+		/// </summary>
+		/// <returns>the new version</returns>
+		static std::uint64_t NextVersion();
+
 		/// <summary>
 		/// the scope's parent
 		/// </summary>
 		Scope* m_Parent = nullptr;
 
+		/// <summary>
+		/// the table in the parent that holds this scope, nullptr if it has no parent
+		/// kept up to date by everything that puts a scope in a table or takes one out, so nothing has to look for it
+		/// </summary>
+		Datum* m_ParentDatum = nullptr;
+
+		/// <summary>
+		/// the index of this scope in m_ParentDatum
+		/// </summary>
+		size_t m_ParentIndex = 0;
+
 		/// <summary>
 		/// the order that string datum pairs were inserted into the scope
 		/// </summary>
@@ -233,6 +369,16 @@ namespace FieaGameEngine
 		/// the map of the string datum pairs
 		/// </summary>
 		MapType m_Map;
+
+		/// <summary>
+		/// the scope's structural version
+		/// </summary>
+		std::uint64_t m_Version = NextVersion();
+
+		/// <summary>
+		/// the last version handed out to any scope
+		/// </summary>
+		inline static std::atomic<std::uint64_t> s_LastVersion{ 0 };
 	};
 
 	ConcreteFactory(Scope, Scope);
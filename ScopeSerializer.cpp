@@ -0,0 +1,274 @@
+#include "pch.h"
+#include "ScopeSerializer.h"
+#include "Factory.h"
+#include "JsonParseCoordinator.h"
+#include "MappedFile.h"
+#include "TableParseHelper.h"
+#include <cstring>
+
+namespace FieaGameEngine
+{
+#pragma region Reader
+	ScopeSerializer::Reader::Reader(const char* data, size_t size) : m_Cursor(data), m_End(data + size) {}
+
+	template <typename T>
+	T ScopeSerializer::Reader::Read()
+	{
+		T value;
+		memcpy(&value, ReadBytes(sizeof(T)), sizeof(T));
+		return value;
+	}
+
+	std::string ScopeSerializer::Reader::ReadString()
+	{
+		std::uint32_t length = Read<std::uint32_t>();
+		return std::string(ReadBytes(length), length);
+	}
+
+	const char* ScopeSerializer::Reader::ReadBytes(size_t count)
+	{
+		if (static_cast<size_t>(m_End - m_Cursor) < count)
+		{
+			throw std::runtime_error("Saved scope data is cut short");
+		}
+
+		const char* bytes = m_Cursor;
+		m_Cursor += count;
+		return bytes;
+	}
+#pragma endregion Reader
+
+#pragma region ScopeSerializer
+	void ScopeSerializer::Save(const Scope& scope, std::ostream& stream)
+	{
+		stream.write(s_Magic, sizeof(s_Magic));
+		Write(s_Version, stream);
+
+		WriteScope(scope, stream);
+
+		if (!stream)
+		{
+			throw std::runtime_error("Could not write the scope");
+		}
+	}
+
+	void ScopeSerializer::SaveToFile(const Scope& scope, const std::string& fileName)
+	{
+		std::ofstream file(fileName, std::ofstream::binary);
+		if (!file)
+		{
+			throw std::runtime_error("Could not open " + fileName);
+		}
+
+		Save(scope, file);
+	}
+
+	void ScopeSerializer::Load(Scope& root, const char* data, size_t size)
+	{
+		Reader reader(data, size);
+
+		if (memcmp(reader.ReadBytes(sizeof(s_Magic)), s_Magic, sizeof(s_Magic)) != 0)
+		{
+			throw std::runtime_error("Data is not saved scope data");
+		}
+
+		if (reader.Read<std::uint32_t>() != s_Version)
+		{
+			throw std::runtime_error("Saved scope data is from a different version");
+		}
+
+		//the root is already made, so its class name is only there to keep every scope the same shape
+		reader.ReadString();
+		ReadMembers(root, reader);
+	}
+
+	void ScopeSerializer::LoadFromFile(Scope& root, const std::string& fileName)
+	{
+		MappedFile file(fileName);
+		Load(root, file.Data(), file.Size());
+	}
+
+	void ScopeSerializer::ConvertJsonFile(const std::string& jsonFileName, const std::string& binaryFileName)
+	{
+		Scope root;
+		TableParseHelper::SharedData data(root);
+		JsonParseCoordinator coordinator(data);
+		TableParseHelper helper;
+		coordinator.AddHelper(helper);
+		coordinator.SetParseMode(JsonParseCoordinator::ParseMode::Streaming);
+
+		coordinator.ParseFromFile(jsonFileName);
+		SaveToFile(root, binaryFileName);
+	}
+
+	void ScopeSerializer::WriteScope(const Scope& scope, std::ostream& stream)
+	{
+		WriteString(scope.TypeNameInstance(), stream);
+
+		std::uint32_t count = 0;
+		for (const Scope::MapPairType* pair : scope.m_Order)
+		{
+			if (IsSaved(pair->second.Type()))
+			{
+				++count;
+			}
+		}
+		Write(count, stream);
+
+		for (const Scope::MapPairType* pair : scope.m_Order)
+		{
+			if (IsSaved(pair->second.Type()))
+			{
+				WriteDatum(pair->first.Name(), pair->second, stream);
+			}
+		}
+	}
+
+	void ScopeSerializer::WriteDatum(const std::string& key, const Datum& datum, std::ostream& stream)
+	{
+		Datum::DatumTypes type = datum.Type();
+
+		WriteString(key, stream);
+		Write(static_cast<std::uint8_t>(type), stream);
+		Write(static_cast<std::uint32_t>(datum.Size()), stream);
+
+		if (datum.Size() == 0)
+		{
+			return;
+		}
+
+		switch (type)
+		{
+		case Datum::DatumTypes::INTEGER:
+			stream.write(reinterpret_cast<const char*>(&datum.Get<int>()), datum.Size() * sizeof(int));
+			break;
+		case Datum::DatumTypes::FLOAT:
+			stream.write(reinterpret_cast<const char*>(&datum.Get<float>()), datum.Size() * sizeof(float));
+			break;
+		case Datum::DatumTypes::VECTOR:
+			stream.write(reinterpret_cast<const char*>(&datum.Get<glm::vec4>()), datum.Size() * sizeof(glm::vec4));
+			break;
+		case Datum::DatumTypes::MATRIX:
+			stream.write(reinterpret_cast<const char*>(&datum.Get<glm::mat4>()), datum.Size() * sizeof(glm::mat4));
+			break;
+		case Datum::DatumTypes::STRING:
+			for (size_t i = 0; i < datum.Size(); ++i)
+			{
+				WriteString(datum.Get<std::string>(i), stream);
+			}
+			break;
+		case Datum::DatumTypes::TABLE:
+			for (size_t i = 0; i < datum.Size(); ++i)
+			{
+				WriteScope(datum.Get<Scope>(i), stream);
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	void ScopeSerializer::WriteString(const std::string& string, std::ostream& stream)
+	{
+		Write(static_cast<std::uint32_t>(string.size()), stream);
+		stream.write(string.data(), string.size());
+	}
+
+	template <typename T>
+	void ScopeSerializer::Write(T value, std::ostream& stream)
+	{
+		stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	void ScopeSerializer::ReadMembers(Scope& scope, Reader& reader)
+	{
+		std::uint32_t attributeCount = reader.Read<std::uint32_t>();
+
+		for (std::uint32_t attribute = 0; attribute < attributeCount; ++attribute)
+		{
+			Key key(reader.ReadString());
+			Datum::DatumTypes type = static_cast<Datum::DatumTypes>(reader.Read<std::uint8_t>());
+			std::uint32_t count = reader.Read<std::uint32_t>();
+
+			if (type == Datum::DatumTypes::TABLE)
+			{
+				//appended even with no children, so an empty table comes back instead of vanishing
+				scope.Append(key).SetType(Datum::DatumTypes::TABLE);
+
+				for (std::uint32_t i = 0; i < count; ++i)
+				{
+					std::string className = reader.ReadString();
+					Scope* child = Factory<Scope>::Create(className);
+
+					if (child == nullptr)
+					{
+						throw std::runtime_error("Appropriate factory was not found");
+					}
+
+					scope.Adopt(*child, key);
+					ReadMembers(*child, reader);
+				}
+				continue;
+			}
+
+			Datum& datum = scope.Append(key);
+
+			if (IsRaw(type))
+			{
+				datum.PushBackRange(reader.ReadBytes(count * RawSize(type)), count, type);
+			}
+			else if (type == Datum::DatumTypes::STRING)
+			{
+				datum.SetType(type);
+				if (!datum.IsExternal())
+				{
+					datum.Reserve(datum.Size() + count);
+				}
+
+				for (std::uint32_t i = 0; i < count; ++i)
+				{
+					if (datum.IsExternal())
+					{
+						datum.Set(reader.ReadString(), i);
+					}
+					else
+					{
+						datum.PushBack(reader.ReadString());
+					}
+				}
+			}
+			else
+			{
+				throw std::runtime_error("Saved scope data has an attribute of an unknown type");
+			}
+		}
+	}
+
+	bool ScopeSerializer::IsSaved(Datum::DatumTypes type)
+	{
+		return (type != Datum::DatumTypes::POINTER && type != Datum::DatumTypes::UNKNOWN);
+	}
+
+	bool ScopeSerializer::IsRaw(Datum::DatumTypes type)
+	{
+		return (type == Datum::DatumTypes::INTEGER || type == Datum::DatumTypes::FLOAT || type == Datum::DatumTypes::VECTOR || type == Datum::DatumTypes::MATRIX);
+	}
+
+	size_t ScopeSerializer::RawSize(Datum::DatumTypes type)
+	{
+		switch (type)
+		{
+		case Datum::DatumTypes::INTEGER:
+			return sizeof(int);
+		case Datum::DatumTypes::FLOAT:
+			return sizeof(float);
+		case Datum::DatumTypes::VECTOR:
+			return sizeof(glm::vec4);
+		case Datum::DatumTypes::MATRIX:
+			return sizeof(glm::mat4);
+		default:
+			return 0;
+		}
+	}
+#pragma endregion ScopeSerializer
+}
@@ -0,0 +1,188 @@
+#pragma once
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include "Scope.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// ScopeSerializer class
+	/// saves scope trees to a compact binary format and loads them back, so baked levels skip json entirely
+	/// numbers, vectors, and matrices are stored as raw arrays and copied straight into their datums when loading,
+	/// and nested scopes are stored with their class name so they come back out of Factory&lt;Scope&gt; as the right type
+	/// pointers are addresses that mean nothing once saved, so they are left out
+	///
+	/// the layout, in the byte order of the machine that saved it:
+	/// header: the four bytes "FSCB", then the version as a uint32
+	/// scope: its class name as a string, its attribute count as a uint32, then each attribute
+	/// attribute: its key as a string, its type as a uint8, its size as a uint32, then the values
+	/// values: raw for integers, floats, vectors, and matrices, each as a string for strings, and each as a scope for tables
+	/// string: its length as a uint32, then its characters
+	/// </summary>
+	class ScopeSerializer final
+	{
+	public:
+		/// <summary>
+		/// the version written into the header, bumped whenever the layout changes
+		/// </summary>
+		static constexpr std::uint32_t s_Version = 1;
+
+		/// <summary>
+		/// deleted constructor since the class is static
+		/// </summary>
+		ScopeSerializer() = delete;
+
+		/// <summary>
+		/// writes a scope and everything under it to a stream
+		/// </summary>
+		/// <param name="scope">the scope to save</param>
+		/// <param name="stream">the stream to write to, opened in binary mode</param>
+		/// <exception cref="runtime_error">throws an exception if the stream can't be written to</exception>
+		static void Save(const Scope& scope, std::ostream& stream);
+
+		/// <summary>
+		/// writes a scope and everything under it to a file
+		/// </summary>
+		/// <param name="scope">the scope to save</param>
+		/// <param name="fileName">the name of the file to write</param>
+		/// <exception cref="runtime_error">throws an exception if the file can't be written to</exception>
+		static void SaveToFile(const Scope& scope, const std::string& fileName);
+
+		/// <summary>
+		/// appends everything in saved data to a scope, the same way parsing it from json would
+		/// </summary>
+		/// <param name="root">the scope to load into</param>
+		/// <param name="data">the first byte of the saved data</param>
+		/// <param name="size">the number of bytes of saved data</param>
+		/// <exception cref="runtime_error">throws an exception if the data is cut short or not saved scope data, or a class has no factory</exception>
+		static void Load(Scope& root, const char* data, size_t size);
+
+		/// <summary>
+		/// memory maps a saved file and loads it into a scope
+		/// </summary>
+		/// <param name="root">the scope to load into</param>
+		/// <param name="fileName">the name of the file to load</param>
+		/// <exception cref="runtime_error">throws an exception if the file can't be opened, or on anything load would throw on</exception>
+		static void LoadFromFile(Scope& root, const std::string& fileName);
+
+		/// <summary>
+		/// parses a json file with the table parse helper and saves the result, for baking assets offline
+		/// the factories for every class in the file have to be registered first
+		/// the json is streamed, so auxiliary attributes are baked in the order they are written rather than sorted by key,
+		/// see JsonParseCoordinator::ParseMode
+		/// </summary>
+		/// <param name="jsonFileName">the name of the json file to convert</param>
+		/// <param name="binaryFileName">the name of the file to write</param>
+		static void ConvertJsonFile(const std::string& jsonFileName, const std::string& binaryFileName);
+
+	private:
+		/// <summary>
+		/// reads values out of saved data, throwing instead of running off the end of it
+		/// </summary>
+		class Reader final
+		{
+		public:
+			/// <summary>
+			/// constructor for the reader
+			/// </summary>
+			/// <param name="data">the first byte of the saved data</param>
+			/// <param name="size">the number of bytes of saved data</param>
+			Reader(const char* data, size_t size);
+
+			/// <summary>
+			/// reads a count or a type
+			/// </summary>
+			/// <returns>the value read</returns>
+			template <typename T>
+			T Read();
+
+			/// <summary>
+			/// reads a length prefixed string
+			/// </summary>
+			/// <returns>the string read</returns>
+			std::string ReadString();
+
+			/// <summary>
+			/// returns the next bytes and moves past them
+			/// </summary>
+			/// <param name="count">the number of bytes</param>
+			/// <returns>the first of the bytes</returns>
+			const char* ReadBytes(size_t count);
+
+		private:
+			/// <summary>
+			/// the next byte to be read
+			/// </summary>
+			const char* m_Cursor;
+
+			/// <summary>
+			/// one past the last byte of the saved data
+			/// </summary>
+			const char* m_End;
+		};
+
+		/// <summary>
+		/// writes a scope's class name and attributes
+		/// </summary>
+		/// <param name="scope">the scope to write</param>
+		/// <param name="stream">the stream to write to</param>
+		static void WriteScope(const Scope& scope, std::ostream& stream);
+
+		/// <summary>
+		/// writes one attribute
+		/// </summary>
+		/// <param name="key">the name of the attribute</param>
+		/// <param name="datum">the attribute's values</param>
+		/// <param name="stream">the stream to write to</param>
+		static void WriteDatum(const std::string& key, const Datum& datum, std::ostream& stream);
+
+		/// <summary>
+		/// writes a length prefixed string
+		/// </summary>
+		/// <param name="string">the string to write</param>
+		/// <param name="stream">the stream to write to</param>
+		static void WriteString(const std::string& string, std::ostream& stream);
+
+		/// <summary>
+		/// writes a count or a type
+		/// </summary>
+		/// <param name="value">the value to write</param>
+		/// <param name="stream">the stream to write to</param>
+		template <typename T>
+		static void Write(T value, std::ostream& stream);
+
+		/// <summary>
+		/// reads a scope's attributes into it, its class name has already been read
+		/// </summary>
+		/// <param name="scope">the scope to read into</param>
+		/// <param name="reader">the reader to read from</param>
+		static void ReadMembers(Scope& scope, Reader& reader);
+
+		/// <summary>
+		/// whether or not attributes of a type are saved
+		/// </summary>
+		/// <param name="type">the type to check</param>
+		/// <returns>false for pointers and attributes without a type</returns>
+		static bool IsSaved(Datum::DatumTypes type);
+
+		/// <summary>
+		/// whether or not a datum type is stored as a raw array
+		/// </summary>
+		/// <param name="type">the type to check</param>
+		/// <returns>true for integers, floats, vectors, and matrices</returns>
+		static bool IsRaw(Datum::DatumTypes type);
+
+		/// <summary>
+		/// the size of one value of a type that is stored as a raw array
+		/// </summary>
+		/// <param name="type">the type to get the size of</param>
+		/// <returns>the size of one value, or zero if the type isn't stored raw</returns>
+		static size_t RawSize(Datum::DatumTypes type);
+
+		/// <summary>
+		/// the four bytes every saved file starts with
+		/// </summary>
+		static constexpr char s_Magic[4] = { 'F', 'S', 'C', 'B' };
+	};
+}
@@ -6,9 +6,11 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(Sector);
 
+	static const Key s_EntitiesKey("m_Entities");
+
 	Sector::Sector() : Attributed(Sector::TypeIdInstance()) 
 	{
-		m_World = static_cast<World*>(m_Parent);
+		GetPrescribed<s_WorldSlot>() = static_cast<RTTI*>(m_Parent);
 	}
 
 	Sector* Sector::Clone()
@@ -28,34 +30,40 @@ namespace FieaGameEngine
 
 	Datum& Sector::Entities()
 	{
-		return *Find("m_Entities");
+		assert(m_Order[s_EntitiesSlot]->first == s_EntitiesKey);
+		return GetPrescribed<s_EntitiesSlot>();
 	}
 
 	Entity* Sector::CreateEntity()
 	{
 		Entity* entity = new Entity();
-		Adopt(*entity, "m_Entities");
+		Adopt(*entity, s_EntitiesKey);
 
 		return entity;
 	}
 
 	World* Sector::GetWorld() const
 	{
-		return m_World;
+		return static_cast<World*>(GetPrescribed<s_WorldSlot>().Get<RTTI*>());
 	}
 
 	void Sector::SetWorld(World& toSet)
 	{
-		m_World = &toSet;
-		m_World->Adopt(*this, "m_Sectors");
+		GetPrescribed<s_WorldSlot>() = static_cast<RTTI*>(&toSet);
+		toSet.Adopt(*this, "m_Sectors");
 	}
 
 	void Sector::Update(WorldState& worldState)
+	{
+		UpdateEntities(worldState, 0, Entities().Size());
+	}
+
+	void Sector::UpdateEntities(WorldState& worldState, size_t begin, size_t end)
 	{
 		worldState.m_CurrentSector = this;
 		Datum& entities = Entities();
 
-		for (size_t i = 0; i < entities.Size(); ++i)
+		for (size_t i = begin; i < end; ++i)
 		{
 			Entity* entitity = static_cast<Entity*>(&(entities.Get<Scope>(i)));
 			entitity->Update(worldState);
@@ -65,11 +73,11 @@ namespace FieaGameEngine
 
 	std::string Sector::Name() const
 	{
-		return m_Name;
+		return GetPrescribed<s_NameSlot>().Get<std::string>();
 	}
 
 	void Sector::SetName(const std::string& name)
 	{
-		m_Name = name;
+		GetPrescribed<s_NameSlot>() = name;
 	}
 }
\ No newline at end of file
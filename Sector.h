@@ -54,6 +54,15 @@ namespace FieaGameEngine
 		/// <param name="worldState">the worldstate needed for the update</param>
 		void Update(WorldState& worldState);
 
+		/// <summary>
+		/// calls update on a range of its entities
+		/// lets a parallel update split a big sector into batches
+		/// </summary>
+		/// <param name="worldState">the worldstate needed for the update</param>
+		/// <param name="begin">the index of the first entity to update</param>
+		/// <param name="end">one past the index of the last entity to update</param>
+		void UpdateEntities(WorldState& worldState, size_t begin, size_t end);
+
 		/// <summary>
 		/// gets the world that this sector is a part of
 		/// </summary>
@@ -96,14 +105,31 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <returns>the array of signatures</returns>
 		static const Vector<Signature> Signatures();
+
+		/// <summary>
+		/// the slot of m_Name, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_NameSlot = 1;
+
+		/// <summary>
+		/// the slot of m_World, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_WorldSlot = 2;
+
+		/// <summary>
+		/// the slot of m_Entities, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_EntitiesSlot = 3;
 	private:
 		/// <summary>
 		/// the name of the sector
+		/// only read through its datum, since it isn't used when the type is stored in columns
 		/// </summary>
 		std::string m_Name;
 
 		/// <summary>
 		/// the world the sector belongs to
+		/// only read through its datum, since it isn't used when the type is stored in columns
 		/// </summary>
 		World* m_World = nullptr;
 	};
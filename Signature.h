@@ -42,5 +42,11 @@ namespace FieaGameEngine
 		/// its offset from this (in bytes)
 		/// </summary>
 		size_t m_Offset;
+
+		/// <summary>
+		/// the attributes index in the scope's order once populated
+		/// filled in by the type manager when the type is added, "this" is always slot 0
+		/// </summary>
+		size_t m_Slot = 0;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include "pch.h"
+#include "SlabAllocator.h"
+
+namespace FieaGameEngine
+{
+	SlabAllocator& SlabAllocator::Instance()
+	{
+		static SlabAllocator* instance = new SlabAllocator();
+		return *instance;
+	}
+
+	SlabAllocator::~SlabAllocator()
+	{
+		for (SizeClass& sizeClass : m_Classes)
+		{
+			SlabHeader* slab = sizeClass.m_Slabs;
+			while (slab != nullptr)
+			{
+				SlabHeader* next = slab->m_Next;
+				::operator delete(slab, std::align_val_t{ s_Granularity });
+				slab = next;
+			}
+		}
+	}
+
+	void* SlabAllocator::Allocate(size_t size)
+	{
+		if (size == 0 || size > s_MaxBlockSize)
+		{
+			return ::operator new(size, std::align_val_t{ s_Granularity });
+		}
+
+		size_t index = ClassIndex(size);
+		size_t blockSize = (index + 1) * s_Granularity;
+		SizeClass& sizeClass = m_Classes[index];
+
+		std::lock_guard<std::mutex> lock(sizeClass.m_Mutex);
+
+		if (sizeClass.m_FreeList != nullptr)
+		{
+			FreeBlock* block = sizeClass.m_FreeList;
+			sizeClass.m_FreeList = block->m_Next;
+			return block;
+		}
+
+		if (sizeClass.m_Bump == nullptr || sizeClass.m_Bump + blockSize > sizeClass.m_BumpEnd)
+		{
+			//plain new only promises alignof(std::max_align_t), which is 8 on 32 bit windows
+			SlabHeader* slab = static_cast<SlabHeader*>(::operator new(s_SlabSize, std::align_val_t{ s_Granularity }));
+			slab->m_Next = sizeClass.m_Slabs;
+			sizeClass.m_Slabs = slab;
+			++sizeClass.m_SlabCount;
+
+			sizeClass.m_Bump = reinterpret_cast<std::uint8_t*>(slab) + sizeof(SlabHeader);
+			sizeClass.m_BumpEnd = reinterpret_cast<std::uint8_t*>(slab) + s_SlabSize;
+		}
+
+		void* block = sizeClass.m_Bump;
+		sizeClass.m_Bump += blockSize;
+		return block;
+	}
+
+	void SlabAllocator::Deallocate(void* block, size_t size)
+	{
+		if (block == nullptr)
+		{
+			return;
+		}
+
+		if (size == 0 || size > s_MaxBlockSize)
+		{
+			::operator delete(block, std::align_val_t{ s_Granularity });
+			return;
+		}
+
+		SizeClass& sizeClass = m_Classes[ClassIndex(size)];
+
+		std::lock_guard<std::mutex> lock(sizeClass.m_Mutex);
+
+		FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+		freeBlock->m_Next = sizeClass.m_FreeList;
+		sizeClass.m_FreeList = freeBlock;
+	}
+
+	size_t SlabAllocator::SlabCount() const
+	{
+		size_t count = 0;
+		for (const SizeClass& sizeClass : m_Classes)
+		{
+			count += sizeClass.m_SlabCount;
+		}
+
+		return count;
+	}
+
+	size_t SlabAllocator::ClassIndex(size_t size)
+	{
+		assert(size > 0 && size <= s_MaxBlockSize);
+		return (size - 1) / s_Granularity;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// SlabAllocator class
+	/// hands out small blocks from big slabs, one free list per size class
+	/// blocks are rounded up to a multiple of 16 bytes, anything bigger than s_MaxBlockSize goes straight to the heap
+	/// every block is aligned to 16 bytes, even where the heap itself only aligns to 8, so types holding vec4 or mat4 can live in them
+	/// freed blocks go back onto their free list, slabs are only given back when the allocator is destroyed
+	/// </summary>
+	class SlabAllocator final
+	{
+	public:
+		/// <summary>
+		/// the alignment of every block, and the step between size classes
+		/// </summary>
+		static constexpr size_t s_Granularity = 16;
+
+		/// <summary>
+		/// the biggest block that comes out of a slab
+		/// </summary>
+		static constexpr size_t s_MaxBlockSize = 512;
+
+		/// <summary>
+		/// the size of each slab in bytes
+		/// </summary>
+		static constexpr size_t s_SlabSize = 64 * 1024;
+
+		/// <summary>
+		/// returns the allocator shared by everything that doesn't make its own
+		/// never destroyed, so blocks can still be freed by static destructors
+		/// </summary>
+		/// <returns>the shared allocator</returns>
+		static SlabAllocator& Instance();
+
+		/// <summary>
+		/// defaulted constructor, no slabs are made until the first allocation
+		/// </summary>
+		SlabAllocator() = default;
+
+		/// <summary>
+		/// deleted copy constructor
+		/// </summary>
+		SlabAllocator(const SlabAllocator&) = delete;
+
+		/// <summary>
+		/// deleted move constructor
+		/// </summary>
+		SlabAllocator(SlabAllocator&&) = delete;
+
+		/// <summary>
+		/// deleted copy assignment operator
+		/// </summary>
+		SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+		/// <summary>
+		/// deleted move assignment operator
+		/// </summary>
+		SlabAllocator& operator=(SlabAllocator&&) = delete;
+
+		/// <summary>
+		/// destructor for the allocator
+		/// frees every slab, any block still handed out is gone after this
+		/// </summary>
+		~SlabAllocator();
+
+		/// <summary>
+		/// allocates a block
+		/// </summary>
+		/// <param name="size">the size of the block in bytes</param>
+		/// <returns>the block, aligned to s_Granularity</returns>
+		void* Allocate(size_t size);
+
+		/// <summary>
+		/// returns a block to its free list
+		/// </summary>
+		/// <param name="block">the block to be freed, nullptr does nothing</param>
+		/// <param name="size">the size that was passed to Allocate</param>
+		void Deallocate(void* block, size_t size);
+
+		/// <summary>
+		/// returns how many slabs have been taken from the heap
+		/// </summary>
+		/// <returns>the number of slabs</returns>
+		size_t SlabCount() const;
+
+	private:
+		/// <summary>
+		/// the number of size classes
+		/// </summary>
+		static constexpr size_t s_ClassCount = s_MaxBlockSize / s_Granularity;
+
+		/// <summary>
+		/// a free block, the link is written over the block itself
+		/// </summary>
+		struct FreeBlock final
+		{
+			FreeBlock* m_Next;
+		};
+
+		/// <summary>
+		/// the header at the start of every slab, links all the slabs so they can be freed
+		/// </summary>
+		struct alignas(s_Granularity) SlabHeader final
+		{
+			SlabHeader* m_Next;
+		};
+
+		/// <summary>
+		/// everything for one size class
+		/// each class has its own lock so different sized allocations don't wait on each other
+		/// </summary>
+		struct SizeClass final
+		{
+			std::mutex m_Mutex;
+			FreeBlock* m_FreeList = nullptr;
+			std::uint8_t* m_Bump = nullptr;
+			std::uint8_t* m_BumpEnd = nullptr;
+			SlabHeader* m_Slabs = nullptr;
+			size_t m_SlabCount = 0;
+		};
+
+		/// <summary>
+		/// returns the size class for a size
+		/// </summary>
+		/// <param name="size">the size in bytes, must be between 1 and s_MaxBlockSize</param>
+		/// <returns>the index of the size class</returns>
+		static size_t ClassIndex(size_t size);
+
+		/// <summary>
+		/// the size classes, index i holds blocks of (i + 1) * s_Granularity bytes
+		/// </summary>
+		SizeClass m_Classes[s_ClassCount];
+	};
+}
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "TableParseHelper.h"
 #include <cassert>
 #include "Factory.h"
+#include "GlmText.h"
 
 namespace FieaGameEngine
 {
@@ -19,7 +20,27 @@ namespace FieaGameEngine
 
 	TableParseHelper::SharedData* TableParseHelper::SharedData::Create() const
 	{
-		return new SharedData();
+		SharedData* data = new SharedData();
+		data->m_OwnedRoot = std::make_unique<Scope>();
+		data->m_RootScope = data->m_OwnedRoot.get();
+		return data;
+	}
+
+	void TableParseHelper::SharedData::Merge(JsonParseCoordinator::SharedData& other)
+	{
+		TableParseHelper::SharedData* customOther = other.As<TableParseHelper::SharedData>();
+
+		if (customOther == nullptr)
+		{
+			throw std::runtime_error("Shared data is not table shared data");
+		}
+
+		if (m_RootScope == nullptr || customOther->m_RootScope == nullptr)
+		{
+			throw std::runtime_error("Root scope is null");
+		}
+
+		m_RootScope->Absorb(*customOther->m_RootScope);
 	}
 
 #pragma endregion Shared Data
@@ -67,23 +88,18 @@ namespace FieaGameEngine
 		else if (key == "value")
 		{
 			StackFrame& top = m_Stack.Top();
-			if (top.m_CurrentDatum->Type() != Datum::DatumTypes::TABLE)
+			if (top.m_CurrentDatum->Type() == Datum::DatumTypes::TABLE)
+			{
+				PushTable(key);
+			}
+			else if (top.m_CurrentDatum->Type() <= Datum::DatumTypes::MATRIX)
 			{
 				SetFunctions setFunc = m_SetFunctions[static_cast<int>(top.m_CurrentDatum->Type())];
 				(this->*setFunc)(value);
 			}
 			else
 			{
-				Scope* scope = Factory<Scope>::Create(top.m_CurrentClass);
-
-				if (scope == nullptr)
-				{
-					throw std::runtime_error("Appropriate factory was not found");
-				}
-
-				top.m_CurrentScope->Adopt(*scope, top.m_CurrentKey);
-
-				m_Stack.Push(StackFrame(*scope, top.m_CurrentDatum, top.m_CurrentClass, key));
+				throw std::runtime_error("Attribute has no type that can be parsed, its type has to come before its value");
 			}
 		}
 		else
@@ -98,10 +114,103 @@ namespace FieaGameEngine
 				return false;
 			}
 
-			Scope* context = m_Stack.IsEmpty() ? customSharedData->m_RootScope : m_Stack.Top().m_CurrentScope;
-			m_Stack.Push(StackFrame(*context, nullptr, "Scope", key));
+			PushAttribute(*customSharedData, key);
+		}
+
+		return true;
+	}
+
+	bool TableParseHelper::StartStringHandler(JsonParseCoordinator::SharedData& data, const std::string& key, std::string_view value, bool isArray)
+	{
+		if (key != "value" || m_Stack.IsEmpty() || !data.Is(TableParseHelper::SharedData::TypeIdClass()))
+		{
+			return IJsonParseHelper::StartStringHandler(data, key, value, isArray);
+		}
+
+		Datum& datum = *m_Stack.Top().m_CurrentDatum;
+
+		switch (datum.Type())
+		{
+		case Datum::DatumTypes::STRING:
+			if (datum.IsExternal())
+			{
+				datum.Set(std::string(value));
+			}
+			else
+			{
+				datum.PushBack(std::string(value));
+			}
+			return true;
+
+		case Datum::DatumTypes::VECTOR:
+			if (datum.IsExternal())
+			{
+				datum.Set(GlmText::ParseVector(value));
+			}
+			else
+			{
+				datum.PushBack(GlmText::ParseVector(value));
+			}
+			return true;
+
+		case Datum::DatumTypes::MATRIX:
+			if (datum.IsExternal())
+			{
+				datum.Set(GlmText::ParseMatrix(value));
+			}
+			else
+			{
+				datum.PushBack(GlmText::ParseMatrix(value));
+			}
+			return true;
 
-			m_Stack.Top().m_CurrentDatum  = &(m_Stack.Top().m_CurrentScope->Append(key));
+		default:
+			return IJsonParseHelper::StartStringHandler(data, key, value, isArray);
+		}
+	}
+
+	bool TableParseHelper::StartObjectHandler(JsonParseCoordinator::SharedData& data, const std::string& key)
+	{
+		TableParseHelper::SharedData* customSharedData = data.As<TableParseHelper::SharedData>();
+
+		if (customSharedData == nullptr)
+		{
+			return false;
+		}
+
+		if (customSharedData->m_RootScope == nullptr)
+		{
+			throw std::runtime_error("Root scope is null");
+		}
+
+		if (key == "type" || key == "class")
+		{
+			return false;
+		}
+
+		//an attribute object only holds its type, class and value, so any other object directly in it is skipped like the whole document would skip it
+		if (!m_Stack.IsEmpty() && m_Stack.Top().m_IsAttribute && key != "value" && data.Depth() == m_Stack.Top().m_Depth + 1)
+		{
+			return false;
+		}
+
+		if (key == "value")
+		{
+			if (m_Stack.IsEmpty())
+			{
+				return false;
+			}
+
+			if (m_Stack.Top().m_CurrentDatum->Type() != Datum::DatumTypes::TABLE)
+			{
+				throw std::runtime_error("Value is an object but the attribute isn't a table, its type has to come before its value");
+			}
+
+			PushTable(key);
+		}
+		else
+		{
+			PushAttribute(*customSharedData, key);
 		}
 
 		return true;
@@ -120,7 +229,56 @@ namespace FieaGameEngine
 		}
 		return true;
 	}
-	
+
+	bool TableParseHelper::EndObjectHandler(JsonParseCoordinator::SharedData& data, const std::string& key)
+	{
+		StackFrame& top = m_Stack.Top();
+
+		if (&(top.m_CurrentKey) == &key && top.m_Appended && top.m_CurrentDatum->Type() == Datum::DatumTypes::UNKNOWN)
+		{
+			Scope& scope = *top.m_CurrentScope;
+			Datum* datum = top.m_CurrentDatum;
+			m_Stack.Pop();
+
+			//it is still the last one unless an array of objects in its value appended after it, then it is left in place
+			if (&scope[scope.Size() - 1] == datum)
+			{
+				scope.Truncate(scope.Size() - 1);
+			}
+
+			return true;
+		}
+
+		return EndHandler(data, key);
+	}
+
+	void TableParseHelper::PushAttribute(TableParseHelper::SharedData& data, const std::string& key)
+	{
+		Scope* context = m_Stack.IsEmpty() ? data.m_RootScope : m_Stack.Top().m_CurrentScope;
+		m_Stack.Push(StackFrame(*context, nullptr, "Scope", key));
+
+		StackFrame& top = m_Stack.Top();
+		size_t size = context->Size();
+
+		top.m_CurrentDatum = &(context->Append(key));
+		top.m_IsAttribute = true;
+		top.m_Depth = data.Depth();
+		top.m_Appended = (context->Size() > size);
+	}
+
+	void TableParseHelper::PushTable(const std::string& key)
+	{
+		StackFrame& top = m_Stack.Top();
+		Scope* scope = Factory<Scope>::Create(top.m_CurrentClass);
+
+		if (scope == nullptr)
+		{
+			throw std::runtime_error("Appropriate factory was not found");
+		}
+
+		top.m_CurrentScope->Adopt(*scope, top.m_CurrentKey);
+		m_Stack.Push(StackFrame(*scope, top.m_CurrentDatum, top.m_CurrentClass, key));
+	}
 
 #pragma endregion Table Parse Helper
 
@@ -17,6 +17,7 @@ namespace FieaGameEngine
 	/// the attribute type should correspond with a datum type, save for pointer.
 	/// floats and ints can be the raw values, vectors and matrices must be represented as strings.
 	/// tables should be sub-objects under value.
+	/// when the coordinator is streaming, "type" and "class" have to come before "value", which is the order jsoncpp writes them in
 	/// </summary>
 	class TableParseHelper : public IJsonParseHelper
 	{
@@ -43,15 +44,28 @@ namespace FieaGameEngine
 			virtual void Initialize() override;
 
 			/// <summary>
-			/// creates a new empty shared data on the heap
+			/// creates a new empty shared data on the heap, with a root scope of its own
 			/// </summary>
 			/// <returns>the new shared data</returns>
 			virtual SharedData* Create() const override;
 
+			/// <summary>
+			/// moves everything in the other shared data's root scope onto the end of this one's
+			/// </summary>
+			/// <param name="other">the shared data to take the results from</param>
+			/// <exception cref="runtime_error">throws an exception if either root scope is nullptr, or the other isn't table shared data</exception>
+			virtual void Merge(JsonParseCoordinator::SharedData& other) override;
+
 			/// <summary>
 			/// the root scope being written to
 			/// </summary>
 			Scope* m_RootScope = nullptr;
+
+		private:
+			/// <summary>
+			/// the root scope made by create, nullptr if the root belongs to someone else
+			/// </summary>
+			std::unique_ptr<Scope> m_OwnedRoot;
 		};
 
 	private:
@@ -91,6 +105,21 @@ namespace FieaGameEngine
 			/// the key of whatever is being parsed at the time
 			/// </summary>
 			const std::string& m_CurrentKey;
+
+			/// <summary>
+			/// whether or not the frame is for an attribute object, rather than a table's value
+			/// </summary>
+			bool m_IsAttribute = false;
+
+			/// <summary>
+			/// the nesting depth the frame's object was opened at
+			/// </summary>
+			size_t m_Depth = 0;
+
+			/// <summary>
+			/// whether or not the attribute was appended for this frame, rather than already being in the scope
+			/// </summary>
+			bool m_Appended = false;
 		};
 
 	public:
@@ -118,6 +147,19 @@ namespace FieaGameEngine
 		/// <exception cref="std::runtime_error">throws an exception if the root scope is nullptr</exception>
 		virtual bool StartHandler(JsonParseCoordinator::SharedData& data, const std::string& key, const Json::Value& value, bool isArray) override;
 
+		/// <summary>
+		/// the streaming version of starthandler for strings
+		/// a string, vector or matrix value is read straight from the tokenizer's buffer, so a string is copied once and moved into its datum
+		/// anything else goes to starthandler
+		/// </summary>
+		/// <param name="data">the shared data to append to</param>
+		/// <param name="key">the key of the string</param>
+		/// <param name="value">the string</param>
+		/// <param name="isArray">whether or not the string is an element of an array</param>
+		/// <returns>whether or not the handler took the string</returns>
+		/// <exception cref="std::runtime_error">throws an exception if the root scope is nullptr, or a vector or matrix isn't valid</exception>
+		virtual bool StartStringHandler(JsonParseCoordinator::SharedData& data, const std::string& key, std::string_view value, bool isArray) override;
+
 		/// <summary>
 		/// pops whatever is on top of the stack off, if the keys are at the same address
 		/// </summary>
@@ -126,7 +168,42 @@ namespace FieaGameEngine
 		/// <returns>whether or not the handler succeeded</returns>
 		virtual bool EndHandler(JsonParseCoordinator::SharedData& data, const std::string& key) override;
 
+		/// <summary>
+		/// the streaming version of starthandler for objects
+		/// appends an attribute for an attribute object, or creates and adopts a new scope for a table's value
+		/// the object's members haven't been read yet, so an attribute object is taken on trust instead of checked for its type and value
+		/// </summary>
+		/// <param name="data">the shared data to append to</param>
+		/// <param name="key">the key of the object</param>
+		/// <returns>whether or not the handler took the object</returns>
+		/// <exception cref="std::runtime_error">throws an exception if the root scope is nullptr, or a value object comes before its table type</exception>
+		virtual bool StartObjectHandler(JsonParseCoordinator::SharedData& data, const std::string& key) override;
+
+		/// <summary>
+		/// the streaming version of endhandler for objects
+		/// an attribute object that never got a type wasn't an attribute after all, so if it was appended for the object it is taken back out,
+		/// the same as parsing the whole document would have skipped it
+		/// </summary>
+		/// <param name="data">the shared data being used</param>
+		/// <param name="key">the key of the object</param>
+		/// <returns>whether or not the handler succeeded</returns>
+		virtual bool EndObjectHandler(JsonParseCoordinator::SharedData& data, const std::string& key) override;
+
 	private:
+		/// <summary>
+		/// appends the attribute with the given name to the current scope, and pushes it onto the stack
+		/// </summary>
+		/// <param name="data">the shared data with the root scope</param>
+		/// <param name="key">the name of the attribute</param>
+		void PushAttribute(TableParseHelper::SharedData& data, const std::string& key);
+
+		/// <summary>
+		/// creates a scope of the current class, adopts it into the current attribute, and pushes it onto the stack
+		/// </summary>
+		/// <param name="key">the key of the table's value</param>
+		/// <exception cref="std::runtime_error">throws an exception if there's no factory for the class</exception>
+		void PushTable(const std::string& key);
+
 		/// <summary>
 		/// helper functions that converts a json value to its intended type and pushes it back
 		/// </summary>
@@ -0,0 +1,152 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include "Event.h"
+#include "EventMessageAttributed.h"
+#include "Factory.h"
+#include "JobSystem.h"
+#include "JsonParseCoordinator.h"
+#include "ReactionAttributed.h"
+#include "TableParseHelper.h"
+#include "TypeManager.h"
+
+using namespace FieaGameEngine;
+
+namespace
+{
+	/// <summary>
+	/// registers the types a reaction needs, and takes them and every subscription back out afterwards
+	/// </summary>
+	class EventDispatchTests : public ::testing::Test
+	{
+	protected:
+		void SetUp() override
+		{
+			TypeManager::RegisterType<ActionList>();
+			TypeManager::RegisterType<Reaction, ActionList>();
+			TypeManager::RegisterType<ReactionAttributed, ActionList>();
+			TypeManager::RegisterType<EventMessageAttributed>();
+		}
+
+		void TearDown() override
+		{
+			Event<EventMessageAttributed>::UnsubscribeAll();
+			TypeManager::Clear();
+		}
+
+		/// <summary>
+		/// delivers a message of the given subtype straight away, with a "hit" auxiliary attribute
+		/// </summary>
+		/// <param name="subtype">the subtype of the message</param>
+		void Deliver(const std::string& subtype)
+		{
+			EventMessageAttributed message;
+			message.SetSubtype(subtype);
+			message.SetWorldState(m_WorldState);
+			message.AppendAuxiliaryAttribute("hit") = subtype;
+			Event<EventMessageAttributed>(message).Deliver();
+		}
+
+		WorldState m_WorldState;
+	};
+
+	TEST_F(EventDispatchTests, SubtypeWrittenThroughDatumReroutes)
+	{
+		ReactionAttributed reaction;
+		reaction.SetSubtype("old");
+		Deliver("old");
+		ASSERT_NE(nullptr, reaction.Find("hit"));
+		EXPECT_EQ("old", reaction.Find("hit")->Get<std::string>());
+
+		//no call to RoutesChanged, writing the datum has to be enough
+		reaction["m_Subtype"] = std::string("new");
+		Deliver("old");
+		EXPECT_EQ("old", reaction.Find("hit")->Get<std::string>());
+		Deliver("new");
+		EXPECT_EQ("new", reaction.Find("hit")->Get<std::string>());
+
+		reaction.Find("m_Subtype")->Set(std::string("newer"));
+		Deliver("new");
+		EXPECT_EQ("new", reaction.Find("hit")->Get<std::string>());
+		Deliver("newer");
+		EXPECT_EQ("newer", reaction.Find("hit")->Get<std::string>());
+	}
+
+	TEST_F(EventDispatchTests, CopiedReactionWatchesItsOwnSubtype)
+	{
+		ReactionAttributed original;
+		original.SetSubtype("a");
+
+		ReactionAttributed copy(original);
+		Event<EventMessageAttributed>::Subscribe(copy);
+		Deliver("a");
+		ASSERT_NE(nullptr, copy.Find("hit"));
+
+		copy["m_Subtype"] = std::string("b");
+		Deliver("b");
+		EXPECT_EQ("b", copy.Find("hit")->Get<std::string>());
+		EXPECT_EQ("a", original.Find("hit")->Get<std::string>());
+	}
+
+	TEST_F(EventDispatchTests, ReactionsParsedOnWorkersAreSubscribed)
+	{
+		//each reaction subscribes from its constructor, which runs on whichever worker parses its file
+		constexpr size_t fileCount = 8;
+		constexpr size_t reactionsPerFile = 16;
+
+		ScopeFactory scopeFactory;
+		ReactionAttributedFactory reactionFactory;
+
+		Vector<std::string> fileNames;
+		for (size_t file = 0; file < fileCount; ++file)
+		{
+			std::string fileName = ::testing::TempDir() + "EventDispatchTests" + std::to_string(file) + ".json";
+			std::ofstream stream(fileName);
+
+			stream << "{ ";
+			for (size_t reaction = 0; reaction < reactionsPerFile; ++reaction)
+			{
+				stream << ((reaction > 0) ? ", " : "") << "\"reaction" << reaction << "\": { \"class\": \"ReactionAttributed\", \"type\": \"table\", "
+					<< "\"value\": { \"m_Subtype\": { \"type\": \"string\", \"value\": \"file" << file << "\" } } }";
+			}
+			stream << " }";
+
+			fileNames.PushBack(fileName);
+		}
+
+		Scope root;
+		{
+			TableParseHelper::SharedData data(root);
+			JsonParseCoordinator coordinator(data);
+			TableParseHelper helper;
+			coordinator.AddHelper(helper);
+
+			JobSystem jobSystem(4);
+			coordinator.ParseFiles(fileNames, jobSystem);
+		}
+
+		for (const std::string& fileName : fileNames)
+		{
+			std::remove(fileName.c_str());
+		}
+
+		for (size_t file = 0; file < fileCount; ++file)
+		{
+			Deliver("file" + std::to_string(file));
+		}
+
+		for (size_t reaction = 0; reaction < reactionsPerFile; ++reaction)
+		{
+			Datum& reactions = *root.Find("reaction" + std::to_string(reaction));
+			ASSERT_EQ(fileCount, reactions.Size());
+
+			for (size_t file = 0; file < fileCount; ++file)
+			{
+				Scope& parsed = reactions.Get<Scope>(file);
+				ASSERT_NE(nullptr, parsed.Find("hit"));
+				EXPECT_EQ(parsed.Find("m_Subtype")->Get<std::string>(), parsed.Find("hit")->Get<std::string>());
+			}
+		}
+	}
+}
@@ -0,0 +1,78 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "FlatHashMap.h"
+
+using namespace FieaGameEngine;
+
+namespace
+{
+	/// <summary>
+	/// fills a small map until it is partway through moving its pairs into a bigger table
+	/// the removes miss, so they only walk the migration along without taking anything out
+	/// </summary>
+	/// <param name="map">the map to fill</param>
+	/// <param name="count">the number of pairs to insert</param>
+	void FillMidMigration(FlatHashMap<int, int>& map, int count)
+	{
+		for (int i = 0; i < count; ++i)
+		{
+			map.Insert(std::make_pair(i * 7, i));
+			if ((i % 3) == 0)
+			{
+				map.Remove(-1 - i);
+			}
+		}
+	}
+
+	/// <summary>
+	/// checks that a map holds exactly the pairs FillMidMigration inserted
+	/// </summary>
+	/// <param name="map">the map to check</param>
+	/// <param name="count">the number of pairs that were inserted</param>
+	void ExpectFilled(const FlatHashMap<int, int>& map, int count)
+	{
+		ASSERT_EQ(static_cast<size_t>(count), map.Size());
+		for (int i = 0; i < count; ++i)
+		{
+			ASSERT_TRUE(map.ContainsKey(i * 7));
+			EXPECT_EQ(i, map.At(i * 7));
+		}
+
+		size_t visited = 0;
+		for (auto it = map.cbegin(); it != map.cend(); ++it)
+		{
+			++visited;
+		}
+		EXPECT_EQ(static_cast<size_t>(count), visited);
+	}
+}
+
+TEST(FlatHashMapTests, ReserveDuringMigrationKeepsEveryPair)
+{
+	for (int count = 1; count < 200; ++count)
+	{
+		FlatHashMap<int, int> map(6, 0.8f);
+		FillMidMigration(map, count);
+		map.Reserve(446);
+		ExpectFilled(map, count);
+	}
+}
+
+TEST(FlatHashMapTests, SetMaxLoadFactorDuringMigrationKeepsEveryPair)
+{
+	for (int count = 1; count < 200; ++count)
+	{
+		FlatHashMap<int, int> map(6, 0.8f);
+		FillMidMigration(map, count);
+		map.SetMaxLoadFactor(0.5f);
+		ExpectFilled(map, count);
+	}
+}
+
+TEST(FlatHashMapTests, GrowDuringMigrationKeepsEveryPair)
+{
+	//inserting one pair at a time makes every grow start while the last one is still being moved
+	FlatHashMap<int, int> map(2, 0.9f);
+	FillMidMigration(map, 5000);
+	ExpectFilled(map, 5000);
+}
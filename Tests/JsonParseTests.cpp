@@ -0,0 +1,188 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "Factory.h"
+#include "JsonParseCoordinator.h"
+#include "JsonTokenizer.h"
+#include "TableParseHelper.h"
+
+using namespace FieaGameEngine;
+
+namespace
+{
+	using ParseMode = JsonParseCoordinator::ParseMode;
+
+	/// <summary>
+	/// a document with every datum type the table helper reads, escapes, arrays and nested tables
+	/// </summary>
+	const char* const s_Document = R"J({
+		"health": { "type": "integer", "value": 5 },
+		"names": { "type": "string", "value": [ "a\"b long enough for the heap", "é😀 long enough for the heap", "x\\ny" ] },
+		"speeds": { "type": "float", "value": [ 1.5, -2e1, 3 ] },
+		"position": { "type": "vector", "value": "vec4(1, 2, 3, 4)" },
+		"child": { "class": "Scope", "type": "table", "value": {
+			"inner": { "type": "integer", "value": [ 1, 2, 3 ] },
+			"deeper": { "type": "table", "value": { "z": { "type": "string", "value": "zz" } } }
+		} },
+		"kids": { "type": "table", "value": [ { "a": { "type": "integer", "value": 1 } }, { "b": { "type": "integer", "value": 2 } } ] }
+	})J";
+
+	/// <summary>
+	/// parses text into a scope through the table helper, in the given mode
+	/// </summary>
+	/// <param name="scope">the scope to parse into</param>
+	/// <param name="mode">the parse mode</param>
+	/// <param name="text">the json to parse</param>
+	void Parse(Scope& scope, ParseMode mode, const std::string& text)
+	{
+		TableParseHelper::SharedData data(scope);
+		JsonParseCoordinator coordinator(data);
+		TableParseHelper helper;
+		coordinator.AddHelper(helper);
+		coordinator.SetParseMode(mode);
+
+		std::istringstream stream(text);
+		coordinator.Parse(stream);
+	}
+
+	/// <summary>
+	/// wraps a json number in a float attribute
+	/// </summary>
+	/// <param name="number">the number, as written in the json</param>
+	/// <returns>the document</returns>
+	std::string FloatDocument(const std::string& number)
+	{
+		return R"({ "x": { "type": "float", "value": )" + number + " } }";
+	}
+
+	/// <summary>
+	/// registers the scope factory the "class" entries need
+	/// </summary>
+	class JsonParseTests : public ::testing::Test
+	{
+	protected:
+		ScopeFactory m_ScopeFactory;
+	};
+
+	TEST_F(JsonParseTests, StreamingMatchesDocument)
+	{
+		Scope document;
+		Scope streamed;
+		Parse(document, ParseMode::Document, s_Document);
+		Parse(streamed, ParseMode::Streaming, s_Document);
+
+		EXPECT_TRUE(document == streamed);
+		EXPECT_EQ(5, streamed.Find("health")->Get<int>());
+		EXPECT_EQ("a\"b long enough for the heap", streamed.Find("names")->Get<std::string>(0));
+		EXPECT_EQ(document.Find("names")->Get<std::string>(1), streamed.Find("names")->Get<std::string>(1));
+		EXPECT_EQ("x\\ny", streamed.Find("names")->Get<std::string>(2));
+		EXPECT_EQ(-20.0f, streamed.Find("speeds")->Get<float>(1));
+		EXPECT_EQ(glm::vec4(1, 2, 3, 4), streamed.Find("position")->Get<glm::vec4>());
+		EXPECT_EQ("zz", streamed.Find("child")->Get<Scope>().Find("deeper")->Get<Scope>().Find("z")->Get<std::string>());
+		EXPECT_NE(nullptr, streamed.Find("a"));
+		EXPECT_NE(nullptr, streamed.Find("b"));
+	}
+
+	TEST_F(JsonParseTests, StreamingFromFileMatchesDocument)
+	{
+		std::string fileName = ::testing::TempDir() + "JsonParseTests.json";
+		std::ofstream(fileName) << s_Document;
+
+		Scope expected;
+		Parse(expected, ParseMode::Document, s_Document);
+
+		for (ParseMode mode : { ParseMode::Document, ParseMode::Streaming })
+		{
+			Scope scope;
+			TableParseHelper::SharedData data(scope);
+			JsonParseCoordinator coordinator(data);
+			TableParseHelper helper;
+			coordinator.AddHelper(helper);
+			coordinator.SetParseMode(mode);
+			coordinator.ParseFromFile(fileName);
+
+			EXPECT_TRUE(expected == scope);
+		}
+
+		std::remove(fileName.c_str());
+	}
+
+	TEST_F(JsonParseTests, StreamingDropsUntypedAttributeObjects)
+	{
+		//an object with neither a type nor a value is dropped by the document parse, so streaming has to drop it too
+		for (const char* text : {
+			R"({ "foo": { "bar": 1 } })",
+			R"({ "foo": { "bar": { "type": "integer", "value": 1 } } })",
+			R"({ "a": { "type": "integer", "value": 2 }, "foo": { "bar": 1 }, "c": { "type": "integer", "value": 3 } })" })
+		{
+			Scope document;
+			Scope streamed;
+			Parse(document, ParseMode::Document, text);
+			Parse(streamed, ParseMode::Streaming, text);
+
+			EXPECT_TRUE(document == streamed) << text;
+			EXPECT_EQ(nullptr, streamed.Find("foo")) << text;
+		}
+	}
+
+	TEST_F(JsonParseTests, StreamingRejectsBadNumbers)
+	{
+		for (const char* number : { "1-2", "--1", "1.2.3", "1e", "-.5", "01", "1.", ".5", "-", "1e+", "+1" })
+		{
+			Scope scope;
+			EXPECT_THROW(Parse(scope, ParseMode::Streaming, FloatDocument(number)), std::runtime_error) << number;
+		}
+	}
+
+	TEST_F(JsonParseTests, StreamingReadsNumbersLikeDocument)
+	{
+		for (const char* number : { "0", "-0", "1.5", "-2e1", "3E+2", "0.25e-2", "-9223372036854775808" })
+		{
+			Scope document;
+			Scope streamed;
+			Parse(document, ParseMode::Document, FloatDocument(number));
+			Parse(streamed, ParseMode::Streaming, FloatDocument(number));
+
+			EXPECT_TRUE(document == streamed) << number;
+		}
+	}
+
+	TEST_F(JsonParseTests, StreamingRejectsMalformedDocuments)
+	{
+		for (const char* text : {
+			R"({ "a": { "value": 1, "type": "integer" } })",
+			R"({ "a": { "type": "integer", "value": 1 })",
+			"[1]",
+			R"({ "a": tru })" })
+		{
+			Scope scope;
+			EXPECT_THROW(Parse(scope, ParseMode::Streaming, text), std::runtime_error) << text;
+		}
+	}
+
+	TEST_F(JsonParseTests, TokenizerIsIndependentOfBufferSize)
+	{
+		std::istringstream smallStream(s_Document);
+		std::istringstream defaultStream(s_Document);
+		JsonTokenizer small(smallStream, 3);
+		JsonTokenizer whole(defaultStream);
+
+		size_t count = 0;
+		for (;;)
+		{
+			JsonTokenizer::TokenType type = whole.Next();
+			ASSERT_EQ(type, small.Next());
+			if (type == JsonTokenizer::TokenType::End)
+			{
+				break;
+			}
+
+			EXPECT_EQ(whole.Text(), small.Text());
+			++count;
+		}
+
+		EXPECT_GT(count, 50u);
+	}
+}
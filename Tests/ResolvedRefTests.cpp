@@ -0,0 +1,146 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "ResolvedRef.h"
+
+using namespace FieaGameEngine;
+
+namespace
+{
+	/// <summary>
+	/// a root with a float "x", a middle scope under it, and a leaf under that
+	/// </summary>
+	class ResolvedRefTests : public ::testing::Test
+	{
+	protected:
+		void SetUp() override
+		{
+			m_Root.Append("x") = 1.0f;
+			m_Middle = &m_Root.AppendScope("kids");
+			m_Leaf = &m_Middle->AppendScope("kids");
+		}
+
+		Scope m_Root;
+		Scope* m_Middle = nullptr;
+		Scope* m_Leaf = nullptr;
+		const Key m_X{ "x" };
+	};
+
+	TEST_F(ResolvedRefTests, VersionChangesWithKeysNotValues)
+	{
+		std::uint64_t version = m_Root.Version();
+		EXPECT_NE(0u, version);
+
+		m_Root.Find("x")->Set(2.0f);
+		m_Root.Append("x");
+		EXPECT_EQ(version, m_Root.Version());
+
+		m_Root.Append("y");
+		EXPECT_NE(version, m_Root.Version());
+
+		version = m_Root.Version();
+		m_Root.Clear();
+		EXPECT_NE(version, m_Root.Version());
+	}
+
+	TEST_F(ResolvedRefTests, VersionChangesWhenAdoptedOrOrphaned)
+	{
+		std::uint64_t version = m_Leaf->Version();
+		m_Root.Adopt(*m_Leaf, "kids");
+		EXPECT_NE(version, m_Leaf->Version());
+
+		version = m_Leaf->Version();
+		m_Leaf->Orphan();
+		EXPECT_NE(version, m_Leaf->Version());
+		delete m_Leaf;
+	}
+
+	TEST_F(ResolvedRefTests, ResolveMatchesSearch)
+	{
+		ResolvedRef ref;
+		auto [datum, scope] = ref.Resolve(*m_Leaf, m_X);
+
+		EXPECT_EQ(&m_Root, scope);
+		EXPECT_EQ(m_Root.Find("x"), datum);
+		EXPECT_TRUE(ref.IsCurrent(*m_Leaf, m_X));
+		EXPECT_FALSE(ref.IsCurrent(*m_Middle, m_X));
+		EXPECT_FALSE(ref.IsCurrent(*m_Leaf, Key("y")));
+	}
+
+	TEST_F(ResolvedRefTests, ChangesOffThePathKeepItCurrent)
+	{
+		ResolvedRef ref;
+		ref.Resolve(*m_Middle, m_X);
+
+		m_Leaf->Append("x");
+		m_Root.Find("x")->Set(5.0f);
+		EXPECT_TRUE(ref.IsCurrent(*m_Middle, m_X));
+		EXPECT_EQ(5.0f, ref.Resolve(*m_Middle, m_X).first->Get<float>());
+	}
+
+	TEST_F(ResolvedRefTests, ShadowingKeyInvalidatesIt)
+	{
+		ResolvedRef ref;
+		ref.Resolve(*m_Leaf, m_X);
+
+		m_Middle->Append("x") = 5.0f;
+		EXPECT_FALSE(ref.IsCurrent(*m_Leaf, m_X));
+
+		auto [datum, scope] = ref.Resolve(*m_Leaf, m_X);
+		EXPECT_EQ(m_Middle, scope);
+		EXPECT_EQ(5.0f, datum->Get<float>());
+	}
+
+	TEST_F(ResolvedRefTests, ReparentingInvalidatesIt)
+	{
+		ResolvedRef ref;
+		m_Middle->Append("x") = 5.0f;
+		EXPECT_EQ(m_Middle, ref.Resolve(*m_Leaf, m_X).second);
+
+		m_Root.Adopt(*m_Leaf, "kids");
+		EXPECT_FALSE(ref.IsCurrent(*m_Leaf, m_X));
+		EXPECT_EQ(&m_Root, ref.Resolve(*m_Leaf, m_X).second);
+	}
+
+	TEST_F(ResolvedRefTests, MissingKeyIsRememberedUntilAppended)
+	{
+		const Key y("y");
+		ResolvedRef ref;
+
+		auto [datum, scope] = ref.Resolve(*m_Leaf, y);
+		EXPECT_EQ(nullptr, datum);
+		EXPECT_EQ(nullptr, scope);
+		EXPECT_TRUE(ref.IsCurrent(*m_Leaf, y));
+
+		m_Root.Append("y");
+		EXPECT_FALSE(ref.IsCurrent(*m_Leaf, y));
+		EXPECT_EQ(&m_Root, ref.Resolve(*m_Leaf, y).second);
+	}
+
+	TEST_F(ResolvedRefTests, MovedParentInvalidatesIt)
+	{
+		const Key z("z");
+		Scope* parent = new Scope();
+		parent->Append("z");
+		Scope& child = parent->AppendScope("kids");
+
+		ResolvedRef ref;
+		EXPECT_EQ(parent, ref.Resolve(child, z).second);
+
+		//the old parent is freed, so the ref mustn't read it to find out it's gone
+		Scope* moved = new Scope(std::move(*parent));
+		delete parent;
+
+		EXPECT_FALSE(ref.IsCurrent(child, z));
+		EXPECT_EQ(moved, ref.Resolve(child, z).second);
+		delete moved;
+	}
+
+	TEST_F(ResolvedRefTests, ResetForgetsTheLastSearch)
+	{
+		ResolvedRef ref;
+		ref.Resolve(*m_Leaf, m_X);
+		ref.Reset();
+
+		EXPECT_FALSE(ref.IsCurrent(*m_Leaf, m_X));
+	}
+}
@@ -0,0 +1,175 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "Entity.h"
+#include "Factory.h"
+#include "ScopeSerializer.h"
+#include "Sector.h"
+#include "TypeManager.h"
+
+using namespace FieaGameEngine;
+
+namespace
+{
+	/// <summary>
+	/// saves a scope and returns the bytes
+	/// </summary>
+	/// <param name="scope">the scope to save</param>
+	/// <returns>the saved bytes</returns>
+	std::string Save(const Scope& scope)
+	{
+		std::ostringstream stream(std::ios::out | std::ios::binary);
+		ScopeSerializer::Save(scope, stream);
+		return stream.str();
+	}
+
+	/// <summary>
+	/// registers the sector and entity types and factories, and takes the types back out afterwards
+	/// </summary>
+	class ScopeSerializerTests : public ::testing::Test
+	{
+	protected:
+		void SetUp() override
+		{
+			TypeManager::RegisterType<Sector>();
+			TypeManager::RegisterType<Entity>();
+		}
+
+		void TearDown() override
+		{
+			TypeManager::Clear();
+		}
+
+		ScopeFactory m_ScopeFactory;
+		SectorFactory m_SectorFactory;
+		EntityFactory m_EntityFactory;
+	};
+
+	TEST_F(ScopeSerializerTests, RoundTripKeepsEveryType)
+	{
+		Scope saved;
+		saved.Append("ints").PushBack(1);
+		saved.Append("ints").PushBack(-7);
+		saved.Append("float") = 2.5f;
+		saved.Append("vectors").PushBack(glm::vec4(1, 2, 3, 4));
+		saved.Append("vectors").PushBack(glm::vec4(5));
+		saved.Append("matrix") = glm::mat4(3.0f);
+		saved.Append("strings").PushBack(std::string("a string long enough to be on the heap"));
+		saved.Append("strings").PushBack(std::string());
+		saved.Append("empty").SetType(Datum::DatumTypes::FLOAT);
+		saved.AppendScope("kids").Append("x") = 9;
+		saved.AppendScope("kids").AppendScope("deep").Append("y") = 1.0f;
+
+		std::string bytes = Save(saved);
+		Scope loaded;
+		ScopeSerializer::Load(loaded, bytes.data(), bytes.size());
+
+		EXPECT_TRUE(saved == loaded);
+		EXPECT_EQ(-7, loaded.Find("ints")->Get<int>(1));
+		EXPECT_EQ(glm::vec4(5), loaded.Find("vectors")->Get<glm::vec4>(1));
+		EXPECT_EQ(glm::mat4(3.0f), loaded.Find("matrix")->Get<glm::mat4>());
+		EXPECT_EQ("a string long enough to be on the heap", loaded.Find("strings")->Get<std::string>(0));
+		EXPECT_EQ(Datum::DatumTypes::FLOAT, loaded.Find("empty")->Type());
+		EXPECT_EQ(0u, loaded.Find("empty")->Size());
+		ASSERT_EQ(2u, loaded.Find("kids")->Size());
+		EXPECT_EQ(1.0f, loaded.Find("kids")->Get<Scope>(1).Find("deep")->Get<Scope>().Find("y")->Get<float>());
+		EXPECT_EQ(bytes, Save(loaded));
+	}
+
+	TEST_F(ScopeSerializerTests, RoundTripKeepsEmptyTables)
+	{
+		Scope saved;
+		saved.Append("x") = 1;
+		saved.Append("empty").SetType(Datum::DatumTypes::TABLE);
+		saved.AppendScope("kid").Append("inner").SetType(Datum::DatumTypes::TABLE);
+
+		std::string bytes = Save(saved);
+		Scope loaded;
+		ScopeSerializer::Load(loaded, bytes.data(), bytes.size());
+
+		ASSERT_NE(nullptr, loaded.Find("empty"));
+		EXPECT_EQ(Datum::DatumTypes::TABLE, loaded.Find("empty")->Type());
+		EXPECT_EQ(0u, loaded.Find("empty")->Size());
+		EXPECT_EQ(Datum::DatumTypes::TABLE, loaded.Find("kid")->Get<Scope>().Find("inner")->Type());
+		EXPECT_TRUE(saved == loaded);
+		EXPECT_EQ(bytes, Save(loaded));
+	}
+
+	TEST_F(ScopeSerializerTests, RoundTripSkipsPointersAndUntypedDatums)
+	{
+		Scope saved;
+		RTTI* pointer = &saved;
+		saved.Append("pointer") = pointer;
+		saved.Append("untyped");
+		saved.Append("kept") = 3;
+
+		std::string bytes = Save(saved);
+		Scope loaded;
+		ScopeSerializer::Load(loaded, bytes.data(), bytes.size());
+
+		EXPECT_EQ(nullptr, loaded.Find("pointer"));
+		EXPECT_EQ(nullptr, loaded.Find("untyped"));
+		EXPECT_EQ(3, loaded.Find("kept")->Get<int>());
+	}
+
+	TEST_F(ScopeSerializerTests, RoundTripRebuildsClasses)
+	{
+		Scope saved;
+		Sector* sector = new Sector();
+		saved.Adopt(*sector, "sectors");
+		sector->SetName("sector");
+		sector->CreateEntity()->AppendAuxiliaryAttribute("health") = 3;
+
+		std::string bytes = Save(saved);
+		Scope loaded;
+		ScopeSerializer::Load(loaded, bytes.data(), bytes.size());
+
+		Scope& loadedScope = loaded.Find("sectors")->Get<Scope>();
+		ASSERT_TRUE(loadedScope.Is(Sector::TypeIdClass()));
+
+		Sector& loadedSector = static_cast<Sector&>(loadedScope);
+		EXPECT_EQ("sector", loadedSector.Name());
+		ASSERT_EQ(1u, loadedSector.Entities().Size());
+		EXPECT_TRUE(loadedSector.Entities().Get<Scope>().Is(Entity::TypeIdClass()));
+		EXPECT_EQ(3, loadedSector.Entities().Get<Scope>().Find("health")->Get<int>());
+	}
+
+	TEST_F(ScopeSerializerTests, TruncatedDataThrows)
+	{
+		Scope saved;
+		saved.Append("ints").PushBack(1);
+		saved.Append("strings") = std::string("text");
+		saved.AppendScope("kid").Append("x") = 2.0f;
+
+		std::string bytes = Save(saved);
+		for (size_t size = 0; size < bytes.size(); ++size)
+		{
+			Scope loaded;
+			EXPECT_THROW(ScopeSerializer::Load(loaded, bytes.data(), size), std::runtime_error) << size;
+		}
+	}
+
+	TEST_F(ScopeSerializerTests, ConvertedJsonLoadsLikeParsedJson)
+	{
+		std::string jsonName = ::testing::TempDir() + "ScopeSerializerTests.json";
+		std::string binaryName = ::testing::TempDir() + "ScopeSerializerTests.bin";
+		std::ofstream(jsonName) << R"J({
+			"numbers": { "type": "integer", "value": [ 1, 2, 3 ] },
+			"world": { "class": "Sector", "type": "table", "value": { "m_Name": { "type": "string", "value": "sector" } } }
+		})J";
+
+		ScopeSerializer::ConvertJsonFile(jsonName, binaryName);
+		Scope loaded;
+		ScopeSerializer::LoadFromFile(loaded, binaryName);
+
+		ASSERT_EQ(3u, loaded.Find("numbers")->Size());
+		EXPECT_EQ(3, loaded.Find("numbers")->Get<int>(2));
+		ASSERT_TRUE(loaded.Find("world")->Get<Scope>().Is(Sector::TypeIdClass()));
+		EXPECT_EQ("sector", static_cast<Sector&>(loaded.Find("world")->Get<Scope>()).Name());
+
+		std::remove(jsonName.c_str());
+		std::remove(binaryName.c_str());
+	}
+}
@@ -0,0 +1,133 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "Scope.h"
+
+using namespace FieaGameEngine;
+
+namespace
+{
+	/// <summary>
+	/// a root with a table of numbered children, "kids"
+	/// </summary>
+	class ScopeTests : public ::testing::Test
+	{
+	protected:
+		static constexpr int s_KidCount = 8;
+
+		void SetUp() override
+		{
+			for (int i = 0; i < s_KidCount; ++i)
+			{
+				Scope& kid = m_Root.AppendScope("kids");
+				kid.Append("i") = i;
+				m_Kids.PushBack(&kid);
+			}
+		}
+
+		/// <summary>
+		/// checks that every scope in a table knows its parent and exactly where it is
+		/// </summary>
+		/// <param name="parent">the scope the table is in</param>
+		/// <param name="key">the key of the table</param>
+		static void ExpectPlaced(Scope& parent, const std::string& key)
+		{
+			Datum& table = *parent.Find(key);
+			for (size_t i = 0; i < table.Size(); ++i)
+			{
+				Scope& child = table.Get<Scope>(i);
+				EXPECT_EQ(&parent, child.GetParent());
+
+				auto [datum, index] = parent.FindContainedScope(child);
+				EXPECT_EQ(&table, datum);
+				EXPECT_EQ(i, index);
+			}
+		}
+
+		/// <summary>
+		/// returns the numbers of the children left in the root's table, in order
+		/// </summary>
+		Vector<int> KidNumbers()
+		{
+			Vector<int> numbers;
+			Datum& table = *m_Root.Find("kids");
+			for (size_t i = 0; i < table.Size(); ++i)
+			{
+				numbers.PushBack(table.Get<Scope>(i).Find("i")->Get<int>());
+			}
+			return numbers;
+		}
+
+		Scope m_Root;
+		Vector<Scope*> m_Kids;
+	};
+
+	TEST_F(ScopeTests, OrphanKeepsSiblingOrder)
+	{
+		m_Kids[2]->Orphan();
+		delete m_Kids[2];
+		delete m_Kids[5];
+
+		Vector<int> numbers = KidNumbers();
+		ASSERT_EQ(6u, numbers.Size());
+		int expected[] = { 0, 1, 3, 4, 6, 7 };
+		for (size_t i = 0; i < numbers.Size(); ++i)
+		{
+			EXPECT_EQ(expected[i], numbers[i]);
+		}
+		ExpectPlaced(m_Root, "kids");
+	}
+
+	TEST_F(ScopeTests, OrphanUnorderedMovesTheLastSiblingIntoItsPlace)
+	{
+		m_Kids[2]->OrphanUnordered();
+		EXPECT_EQ(nullptr, m_Kids[2]->GetParent());
+		delete m_Kids[2];
+
+		EXPECT_EQ(m_Kids[s_KidCount - 1], &m_Root.Find("kids")->Get<Scope>(2));
+		ExpectPlaced(m_Root, "kids");
+
+		m_Kids[s_KidCount - 2]->OrphanUnordered();
+		delete m_Kids[s_KidCount - 2];
+		EXPECT_EQ(static_cast<size_t>(s_KidCount - 2), m_Root.Find("kids")->Size());
+		ExpectPlaced(m_Root, "kids");
+	}
+
+	TEST_F(ScopeTests, ChildrenKeepTheirPlaceThroughAdoptMoveAndCopy)
+	{
+		Scope other;
+		other.Adopt(*m_Kids[3], "kids");
+		ExpectPlaced(m_Root, "kids");
+		ExpectPlaced(other, "kids");
+
+		Scope* moved = new Scope(std::move(*m_Kids[4]));
+		delete m_Kids[4];
+		EXPECT_EQ(&m_Root, moved->GetParent());
+		ExpectPlaced(m_Root, "kids");
+
+		Scope copy(m_Root);
+		ExpectPlaced(copy, "kids");
+
+		Scope donor;
+		donor.AppendScope("kids").Append("i") = 100;
+		m_Root.Absorb(donor);
+		EXPECT_EQ(100, KidNumbers().Back());
+		ExpectPlaced(m_Root, "kids");
+	}
+
+	TEST_F(ScopeTests, TablesCantBeChangedAroundScope)
+	{
+		Datum& table = *m_Root.Find("kids");
+
+		EXPECT_THROW(table.RemoveAt(0), std::runtime_error);
+		EXPECT_THROW(table.PopBack(), std::runtime_error);
+		EXPECT_THROW(table.Remove(*m_Kids[1]), std::runtime_error);
+		EXPECT_THROW(table.Set(*m_Kids[1], 0), std::runtime_error);
+
+		Scope loose;
+		EXPECT_THROW(table.Set(loose, 0), std::runtime_error);
+		EXPECT_THROW(m_Root.Append("other") = loose, std::runtime_error);
+
+		EXPECT_EQ(static_cast<size_t>(s_KidCount), table.Size());
+		ExpectPlaced(m_Root, "kids");
+	}
+}
@@ -0,0 +1,92 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "ActionDestroyAction.h"
+#include "ActionIncrement.h"
+#include "ActionList.h"
+#include "TypeManager.h"
+#include "WorldState.h"
+
+using namespace FieaGameEngine;
+
+namespace
+{
+	/// <summary>
+	/// registers the action types, and takes them back out afterwards
+	/// </summary>
+	class WorldStateTests : public ::testing::Test
+	{
+	protected:
+		void SetUp() override
+		{
+			TypeManager::RegisterType<ActionList>();
+			TypeManager::RegisterType<ActionIncrement>();
+			TypeManager::RegisterType<ActionDestroyAction>();
+		}
+
+		void TearDown() override
+		{
+			TypeManager::Clear();
+		}
+
+		/// <summary>
+		/// adds an action list called "target" with a float "value" and an increment of it to the outer list
+		/// </summary>
+		/// <param name="outer">the list to add it to</param>
+		/// <returns>the value's datum</returns>
+		Datum& AddIncrementedList(ActionList& outer)
+		{
+			ActionList* target = new ActionList();
+			target->SetName("target");
+			Datum& value = target->AppendAuxiliaryAttribute("value");
+			value = 1.0f;
+			outer.Adopt(*target, "m_Actions");
+
+			ActionIncrement* increment = new ActionIncrement();
+			increment->SetTarget("value");
+			increment->SetStep(2.0f);
+			target->Adopt(*increment, "m_Actions");
+
+			return value;
+		}
+	};
+
+	TEST_F(WorldStateTests, BatchedIncrementsWaitForApply)
+	{
+		ActionList outer;
+		Datum& value = AddIncrementedList(outer);
+
+		WorldState worldState;
+		worldState.m_BatchIncrements = true;
+		outer.Update(worldState);
+
+		EXPECT_EQ(1.0f, value.Get<float>());
+		EXPECT_EQ(1u, worldState.m_IncrementTargets.Size());
+
+		worldState.ApplyIncrements();
+		EXPECT_EQ(3.0f, value.Get<float>());
+		EXPECT_TRUE(worldState.m_IncrementTargets.IsEmpty());
+	}
+
+	TEST_F(WorldStateTests, DestroyingAnIncrementTargetAppliesTheBatchFirst)
+	{
+		ActionList outer;
+		AddIncrementedList(outer);
+
+		ActionDestroyAction* destroy = new ActionDestroyAction();
+		destroy->SetActionName("target");
+		outer.Adopt(*destroy, "m_Actions");
+
+		//the increment is batched, then its target is destroyed in the same update
+		WorldState worldState;
+		worldState.m_BatchIncrements = true;
+		outer.Update(worldState);
+
+		ASSERT_EQ(1u, outer.Actions().Size());
+		EXPECT_EQ(destroy, &outer.Actions().Get<Scope>());
+		EXPECT_TRUE(worldState.m_IncrementTargets.IsEmpty());
+		EXPECT_TRUE(worldState.m_IncrementSteps.IsEmpty());
+
+		//nothing is left pointing at the destroyed list
+		worldState.ApplyIncrements();
+	}
+}
@@ -3,39 +3,133 @@
 
 namespace FieaGameEngine
 {
-	HashMap<const RTTI::IdType, TypeManager::SignatureList> TypeManager::s_SignatureMap;
+	HashMap<const RTTI::IdType, TypeManager::TypeInfo> TypeManager::s_SignatureMap;
+	std::shared_mutex TypeManager::s_Mutex;
 
-	void TypeManager::AddType(RTTI::IdType id, SignatureList signatures)
+	void TypeManager::AddType(RTTI::IdType id, SignatureList signatures, RTTI::IdType parentId, Storage storage)
 	{
-		if (ContainsKey(id))
+		std::unique_lock<std::shared_mutex> lock(s_Mutex);
+
+		if (s_SignatureMap.ContainsKey(id))
 		{
 			throw std::runtime_error("Type already registered");
 		}
 
-		s_SignatureMap.Insert(make_pair(id, std::move(signatures)));
+		const SignatureList* parentSignatures = (parentId != 0) ? &s_SignatureMap.At(parentId).m_Signatures : nullptr;
+		size_t parentSize = (parentSignatures != nullptr) ? parentSignatures->Size() : 0;
+
+		TypeInfo info;
+		info.m_Signatures.Reserve(parentSize + signatures.Size());
+
+		for (size_t i = 0; i < parentSize; ++i)
+		{
+			info.m_Signatures.PushBack((*parentSignatures)[i]);
+			info.m_Index.Insert(make_pair(info.m_Signatures[i].m_Name, i));
+		}
+
+		for (Signature& signature : signatures)
+		{
+			auto it = info.m_Index.Find(signature.m_Name);
+
+			if (it != info.m_Index.end())
+			{
+				info.m_Signatures[it->second] = std::move(signature);
+			}
+			else
+			{
+				info.m_Index.Insert(make_pair(signature.m_Name, info.m_Signatures.Size()));
+				info.m_Signatures.PushBack(std::move(signature));
+			}
+		}
+
+		for (size_t i = 0; i < info.m_Signatures.Size(); ++i)
+		{
+			info.m_Signatures[i].m_Slot = i + 1;
+		}
+
+		if (storage == Storage::Columns)
+		{
+			info.m_Columns = std::make_unique<ColumnStore>(info.m_Signatures);
+		}
+
+		s_SignatureMap.Insert(make_pair(id, std::move(info)));
 	}
 
 	void TypeManager::RemoveType(RTTI::IdType id)
 	{
+		std::unique_lock<std::shared_mutex> lock(s_Mutex);
+
+		auto it = s_SignatureMap.Find(id);
+		if (it != s_SignatureMap.end() && HasLiveRows(it->second))
+		{
+			throw std::runtime_error("Type still has instances stored in its columns");
+		}
+
 		s_SignatureMap.Remove(id);
 	}
 
-	TypeManager::SignatureList TypeManager::GetSignatures(RTTI::IdType id)
+	const TypeManager::SignatureList& TypeManager::GetSignatures(RTTI::IdType id)
+	{
+		std::shared_lock<std::shared_mutex> lock(s_Mutex);
+		return s_SignatureMap.At(id).m_Signatures;
+	}
+
+	const Signature* TypeManager::FindSignature(RTTI::IdType id, const std::string& name)
 	{
-		return s_SignatureMap.At(id);
+		std::shared_lock<std::shared_mutex> lock(s_Mutex);
+
+		const TypeInfo& info = s_SignatureMap.At(id);
+		auto it = info.m_Index.Find(name);
+
+		return (it != info.m_Index.end()) ? &info.m_Signatures[it->second] : nullptr;
+	}
+
+	size_t TypeManager::SlotOf(RTTI::IdType id, const std::string& name)
+	{
+		const Signature* signature = FindSignature(id, name);
+
+		if (signature == nullptr)
+		{
+			throw std::runtime_error("Attribute not in signatures");
+		}
+
+		return signature->m_Slot;
+	}
+
+	ColumnStore* TypeManager::Columns(RTTI::IdType id)
+	{
+		std::shared_lock<std::shared_mutex> lock(s_Mutex);
+		return s_SignatureMap.At(id).m_Columns.get();
 	}
 
 	size_t TypeManager::Size()
 	{
+		std::shared_lock<std::shared_mutex> lock(s_Mutex);
 		return s_SignatureMap.Size();
 	}
 
 	bool TypeManager::ContainsKey(RTTI::IdType id)
 	{
+		std::shared_lock<std::shared_mutex> lock(s_Mutex);
 		return s_SignatureMap.ContainsKey(id);
 	}
 	void TypeManager::Clear()
 	{
+		std::unique_lock<std::shared_mutex> lock(s_Mutex);
+
+		for (PairType& pair : s_SignatureMap)
+		{
+			if (HasLiveRows(pair.second))
+			{
+				throw std::runtime_error("Type still has instances stored in its columns");
+			}
+		}
+
 		s_SignatureMap.Clear();
 	}
+
+	bool TypeManager::HasLiveRows(TypeInfo& info)
+	{
+		return (info.m_Columns != nullptr && info.m_Columns->LiveCount() > 0);
+	}
 }
\ No newline at end of file
@@ -1,5 +1,10 @@
 #pragma once
+#include <mutex>
+#include <memory>
+#include <shared_mutex>
+#include "ColumnStore.h"
 #include "HashMap.h"
+#include "FlatHashMap.h"
 #include "RTTI.h"
 #include "Signature.h"
 
@@ -8,12 +13,26 @@ namespace FieaGameEngine
 	/// <summary>
 	/// Type Manager class
 	/// singelton class that manages the signatures for any added types
+	/// it can be read from any number of threads at once, and types can be added while it is being read
+	/// removing a type while it is being read is still up to the caller to avoid, since its signatures are handed out by reference
 	/// </summary>
 	class TypeManager final
 	{
 	public:
 		using SignatureList = Vector<Signature>;
 
+		/// <summary>
+		/// where the prescribed attributes of a type's instances are stored
+		/// Members points each datum at the member inside the instance, at the signature's offset
+		/// Columns points each datum at the instance's row in a ColumnStore, so systems can walk one attribute of every instance
+		/// in a straight line, the members are left unused so the type has to read them through its datums
+		/// </summary>
+		enum class Storage
+		{
+			Members,
+			Columns
+		};
+
 		/// <summary>
 		/// deleted constructor for TypeManager since the class is static
 		/// </summary>
@@ -46,23 +65,71 @@ namespace FieaGameEngine
 
 		/// <summary>
 		/// adds a list of signatures based upon the rtti type id passed in
+		/// if a parent is given its table is copied in first, so the parent's slots stay the same in the child
+		/// a child signature with the same name as a parent one replaces it but keeps the parent's slot
+		/// gives every signature its slot in the order, which is its index + 1 since "this" is always first
 		/// </summary>
 		/// <param name="id">the id of the type being added</param>
 		/// <param name="signatures">the signatures of the type being added</param>
-		static void AddType(RTTI::IdType id, SignatureList signatures);
+		/// <param name="parentId">the id of an already added parent type, 0 for none</param>
+		/// <param name="storage">where instances of the type store their prescribed attributes</param>
+		static void AddType(RTTI::IdType id, SignatureList signatures, RTTI::IdType parentId = 0, Storage storage = Storage::Members);
+
+		/// <summary>
+		/// adds a type using its static Signatures function
+		/// </summary>
+		/// <typeparam name="T">the type being added</typeparam>
+		/// <param name="storage">where instances of the type store their prescribed attributes</param>
+		template<typename T>
+		static void RegisterType(Storage storage = Storage::Members);
+
+		/// <summary>
+		/// adds a type using its static Signatures function, merged on top of its parent's
+		/// </summary>
+		/// <typeparam name="T">the type being added</typeparam>
+		/// <typeparam name="TParent">the already added parent of the type</typeparam>
+		/// <param name="storage">where instances of the type store their prescribed attributes</param>
+		template<typename T, typename TParent>
+		static void RegisterType(Storage storage = Storage::Members);
 
 		/// <summary>
 		/// removes a list of signatures
+		/// any instances of a type stored in columns have to be gone first, since the columns go with it
 		/// </summary>
 		/// <param name="id">the type id of the signatures to be removed</param>
+		/// <exception cref="runtime_error">throws an exception if the type is stored in columns and still has instances</exception>
 		static void RemoveType(RTTI::IdType id);
 
 		/// <summary>
 		/// returns the signatures of a given id type
+		/// the table is built once when the type is added, so this never copies
 		/// </summary>
 		/// <param name="id">the type's id to get the signatures of</param>
-		/// <returns>the signatures of that type</returns>
-		static SignatureList GetSignatures(RTTI::IdType id);
+		/// <returns>the signatures of that type, including any merged in from its parent</returns>
+		static const SignatureList& GetSignatures(RTTI::IdType id);
+
+		/// <summary>
+		/// finds a signature by name with a single hash lookup
+		/// </summary>
+		/// <param name="id">the type id that the attribute belongs to</param>
+		/// <param name="name">the name of the attribute</param>
+		/// <returns>the signature, or nullptr if the type has no attribute with that name</returns>
+		static const Signature* FindSignature(RTTI::IdType id, const std::string& name);
+
+		/// <summary>
+		/// returns the slot of a prescribed attribute, for looking one up without hashing its name
+		/// </summary>
+		/// <param name="id">the type id that the attribute belongs to</param>
+		/// <param name="name">the name of the attribute</param>
+		/// <returns>the index of the attribute in the order of any instance of that type</returns>
+		static size_t SlotOf(RTTI::IdType id, const std::string& name);
+
+		/// <summary>
+		/// returns the columns that instances of a type store their prescribed attributes in
+		/// </summary>
+		/// <param name="id">the id of the type</param>
+		/// <returns>the columns, or nullptr if the type stores its attributes in its members</returns>
+		static ColumnStore* Columns(RTTI::IdType id);
 
 		/// <summary>
 		/// returns whether or not an id is in the map
@@ -79,16 +146,56 @@ namespace FieaGameEngine
 
 		/// <summary>
 		/// clears out the map
+		/// nothing is removed if any type stored in columns still has instances
 		/// </summary>
+		/// <exception cref="runtime_error">throws an exception if a type is stored in columns and still has instances</exception>
 		static void Clear();
 
 	private:
-		using PairType = std::pair<const RTTI::IdType, SignatureList>;
+		/// <summary>
+		/// everything stored for one type
+		/// never changes once added
+		/// </summary>
+		struct TypeInfo final
+		{
+			/// <summary>
+			/// the merged signatures, in slot order
+			/// </summary>
+			SignatureList m_Signatures;
+
+			/// <summary>
+			/// maps each signature's name to its index in m_Signatures
+			/// </summary>
+			FlatHashMap<const std::string, size_t> m_Index;
+
+			/// <summary>
+			/// the columns for a type stored in columns, nullptr for one stored in its members
+			/// the store guards itself, so rows can be handed out while the type is only read
+			/// </summary>
+			std::unique_ptr<ColumnStore> m_Columns;
+		};
+
+		using PairType = std::pair<const RTTI::IdType, TypeInfo>;
+
+		/// <summary>
+		/// returns whether or not a type is stored in columns and any of its rows still belong to an instance
+		/// </summary>
+		/// <param name="info">the type</param>
+		/// <returns>whether or not removing the type would leave instances pointing at freed columns</returns>
+		static bool HasLiveRows(TypeInfo& info);
 
 		/// <summary>
 		/// the hashmap that stores the id types and their signatures
+		/// chained so a TypeInfo never moves while the type is added, which keeps the references handed out valid
 		/// </summary>
-		static HashMap<const RTTI::IdType, SignatureList> s_SignatureMap;
+		static HashMap<const RTTI::IdType, TypeInfo> s_SignatureMap;
+
+		/// <summary>
+		/// guards the hashmap, shared by lookups and exclusive for adding and removing types
+		/// </summary>
+		static std::shared_mutex s_Mutex;
 	};
 }
 
+#include "TypeManager.inl"
+
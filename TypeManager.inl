@@ -0,0 +1,21 @@
+#include "pch.h"
+#include "TypeManager.h"
+
+namespace FieaGameEngine
+{
+#pragma region TypeManager
+	//RegisterType
+	template<typename T>
+	inline void TypeManager::RegisterType(Storage storage)
+	{
+		AddType(T::TypeIdClass(), T::Signatures(), 0, storage);
+	}
+
+	//RegisterType
+	template<typename T, typename TParent>
+	inline void TypeManager::RegisterType(Storage storage)
+	{
+		AddType(T::TypeIdClass(), T::Signatures(), TParent::TypeIdClass(), storage);
+	}
+#pragma endregion TypeManager
+}
@@ -1,9 +1,18 @@
 #pragma once
+#include <type_traits>
 #include "DefaultEquality.h"
 #include "DefaultIncrement.h"
 
 namespace FieaGameEngine
 {
+	/// <summary>
+	/// whether or not a type can be moved to a new address with a plain memcpy
+	/// true for trivially copyable types, specialize it for any other type that doesn't point into itself
+	/// </summary>
+	/// <typeparam name="T">the type being checked</typeparam>
+	template <typename T>
+	struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
 	/// <summary>
 	/// vector class
 	/// holds data in an array-like structure, that can be resized as necessary.
@@ -383,6 +392,15 @@ namespace FieaGameEngine
 		template <typename IncrementFunctor = DefaultIncrement>
 		Iterator PushBack(T&& value);
 
+		/// <summary>
+		/// constructs a value in place at the end of the vector and increments size
+		/// if out of space, more is reserved based on the increment functor
+		/// </summary>
+		/// <param name="args">the arguments for the value's constructor</param>
+		/// <returns>an iterator pointing at the newly added value</returns>
+		template <typename IncrementFunctor = DefaultIncrement, typename... Args>
+		Iterator EmplaceBack(Args&&... args);
+
 		/// <summary>
 		/// removes the last element from the list
 		/// does NOT change the size of the capacity
@@ -490,6 +508,21 @@ namespace FieaGameEngine
 		void Remove(const Iterator& startIt, const Iterator& endIt);
 
 	private:
+		/// <summary>
+		/// moves the vector into a new block of memory of the given capacity
+		/// uses realloc for trivially relocatable types, and moves then destroys each element for everything else
+		/// </summary>
+		/// <param name="capacity">the capacity of the new block, must be at least the size</param>
+		void Reallocate(size_t capacity);
+
+		/// <summary>
+		/// moves a run of elements down to a lower index, leaving the source slots destroyed
+		/// </summary>
+		/// <param name="destination">where the first element is moved to, its slot must already be destroyed</param>
+		/// <param name="source">the first element to be moved</param>
+		/// <param name="count">the number of elements to be moved</param>
+		static void Relocate(T* destination, T* source, size_t count);
+
 		/// <summary>
 		/// the pointer to the beginning of the vector
 		/// </summary>
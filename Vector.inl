@@ -181,26 +181,21 @@ namespace FieaGameEngine
 
 	template<typename T>
 	template <typename IncrementFunctor>
-	typename Vector<T>::Iterator Vector<T>::PushBack(const T& value)
+	inline typename Vector<T>::Iterator Vector<T>::PushBack(const T& value)
 	{
-		if (m_Size == m_Capacity)
-		{
-			IncrementFunctor increment;
-			size_t increaseBy = increment(m_Size, m_Capacity);
-			
-			size_t capacity = m_Capacity + std::max(size_t(1), increaseBy);
-
-			Reserve(capacity);
-		}
-
-		new(m_Data + m_Size)T(value);
-
-		return Iterator(*this, m_Size++);
+		return EmplaceBack<IncrementFunctor>(value);
 	}
 
 	template<typename T>
 	template <typename IncrementFunctor>
-	typename Vector<T>::Iterator Vector<T>::PushBack(T&& value)
+	inline typename Vector<T>::Iterator Vector<T>::PushBack(T&& value)
+	{
+		return EmplaceBack<IncrementFunctor>(std::move(value));
+	}
+
+	template<typename T>
+	template <typename IncrementFunctor, typename... Args>
+	typename Vector<T>::Iterator Vector<T>::EmplaceBack(Args&&... args)
 	{
 		if (m_Size == m_Capacity)
 		{
@@ -212,7 +207,7 @@ namespace FieaGameEngine
 			Reserve(capacity);
 		}
 
-		new(m_Data + m_Size)T(std::move(value));
+		new(m_Data + m_Size)T(std::forward<Args>(args)...);
 
 		return Iterator(*this, m_Size++);
 	}
@@ -232,10 +227,7 @@ namespace FieaGameEngine
 	{
 		if (capacity > m_Capacity)
 		{
-			T* data = reinterpret_cast<T*>(realloc(m_Data, sizeof(T) * capacity));
-			assert(data != nullptr);
-			m_Data = data;
-			m_Capacity = capacity;
+			Reallocate(capacity);
 		}
 	}
 
@@ -252,10 +244,7 @@ namespace FieaGameEngine
 			}
 			else
 			{
-				T* data = reinterpret_cast<T*>(realloc(m_Data, sizeof(T) * m_Size));
-				assert(data != nullptr);
-				m_Data = data;
-				m_Capacity = m_Size;
+				Reallocate(m_Size);
 			}
 		}
 	}
@@ -325,20 +314,15 @@ namespace FieaGameEngine
 			throw std::runtime_error("Container does not own this iterator");
 		}
 
-		if (it.m_Index == m_Size - 1)
-		{
-			PopBack();
-		}
-
-		if (it.m_Index >= 0 && it.m_Index < m_Size)
+		if (it.m_Index < m_Size)
 		{
 			T* destination = m_Data + (it.m_Index);
 			T* source = destination + size_t(1);
-			size_t count = (m_Size - (it.m_Index + 1)) * sizeof(T);
+			size_t count = m_Size - (it.m_Index + 1);
 
 			m_Data[it.m_Index].~T();
 
-			memmove(destination, source, count);
+			Relocate(destination, source, count);
 			--m_Size;
 			removed = true;
 		}
@@ -354,24 +338,21 @@ namespace FieaGameEngine
 			throw std::runtime_error("Container does not own both iterators");
 		}
 
-		if (startIt.m_Index >= 0 && startIt.m_Index < m_Size)
+		if (startIt.m_Index < m_Size)
 		{
-			if (endIt.m_Index >= 0 && endIt.m_Index <= m_Size)
+			if (endIt.m_Index > startIt.m_Index && endIt.m_Index <= m_Size)
 			{
 				T* destination = m_Data + startIt.m_Index;
 				T* source = m_Data + endIt.m_Index;
-				size_t count = (m_Size - endIt.m_Index + 1) * sizeof(T);
+				size_t count = m_Size - endIt.m_Index;
 
 				for (size_t i = startIt.m_Index; i < endIt.m_Index; ++i)
 				{
 					m_Data[i].~T();
-					--m_Size;
 				}
 
-				if (endIt != endIt.m_Owner->end())
-				{
-					memmove(destination, source, count);
-				}
+				Relocate(destination, source, count);
+				m_Size -= (endIt.m_Index - startIt.m_Index);
 			}
 		}
 	}
@@ -419,6 +400,52 @@ namespace FieaGameEngine
 			free(m_Data);
 		}
 	}
+
+	template<typename T>
+	void Vector<T>::Reallocate(size_t capacity)
+	{
+		assert(capacity >= m_Size);
+
+		if constexpr (IsTriviallyRelocatable<T>::value)
+		{
+			T* data = reinterpret_cast<T*>(realloc(m_Data, sizeof(T) * capacity));
+			assert(data != nullptr);
+			m_Data = data;
+		}
+		else
+		{
+			T* data = reinterpret_cast<T*>(malloc(sizeof(T) * capacity));
+			assert(data != nullptr);
+
+			for (size_t i = 0; i < m_Size; ++i)
+			{
+				new(data + i)T(std::move(m_Data[i]));
+				m_Data[i].~T();
+			}
+
+			free(m_Data);
+			m_Data = data;
+		}
+
+		m_Capacity = capacity;
+	}
+
+	template<typename T>
+	inline void Vector<T>::Relocate(T* destination, T* source, size_t count)
+	{
+		if constexpr (IsTriviallyRelocatable<T>::value)
+		{
+			memmove(destination, source, count * sizeof(T));
+		}
+		else
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				new(destination + i)T(std::move(source[i]));
+				source[i].~T();
+			}
+		}
+	}
 #pragma endregion Vector
 
 #pragma region Iterator
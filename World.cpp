@@ -6,6 +6,8 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(World);
 
+	static const Key s_SectorsKey("m_Sectors");
+
 	World::World() : Attributed(World::TypeIdInstance()) {}
 
 	World* World::Clone()
@@ -24,23 +26,24 @@ namespace FieaGameEngine
 
 	std::string World::Name() const
 	{
-		return m_Name;
+		return GetPrescribed<s_NameSlot>().Get<std::string>();
 	}
 
 	void World::SetName(const std::string& name)
 	{
-		m_Name = name;
+		GetPrescribed<s_NameSlot>() = name;
 	}
 
 	Datum& World::Sectors()
 	{
-		return *Find("m_Sectors");
+		assert(m_Order[s_SectorsSlot]->first == s_SectorsKey);
+		return GetPrescribed<s_SectorsSlot>();
 	}
 
 	Sector* World::CreateSector()
 	{
 		Sector* sector = new Sector();
-		Adopt(*sector, "m_Sectors");
+		Adopt(*sector, s_SectorsKey);
 
 		return sector;
 	}
@@ -56,7 +59,68 @@ namespace FieaGameEngine
 			sector->Update(worldState);
 		}
 
+		worldState.ApplyIncrements();
+		worldState.CreateActions();
+		worldState.m_CurrentWorld = nullptr;
+	}
+
+	void World::Update(WorldState& worldState, JobSystem& jobSystem, size_t entityBatchSize)
+	{
+		struct Batch final
+		{
+			Sector* m_Sector;
+			size_t m_Begin;
+			size_t m_End;
+		};
+
+		worldState.m_CurrentWorld = this;
+		Datum& sectors = Sectors();
+		Vector<Batch> batches(sectors.Size());
+
+		for (size_t i = 0; i < sectors.Size(); ++i)
+		{
+			Sector* sector = static_cast<Sector*>(&(sectors.Get<Scope>(i)));
+			size_t entityCount = sector->Entities().Size();
+			size_t batchSize = (entityBatchSize > 0) ? entityBatchSize : std::max<size_t>(entityCount, 1);
+
+			for (size_t begin = 0; begin < entityCount; begin += batchSize)
+			{
+				batches.PushBack(Batch{ sector, begin, std::min(begin + batchSize, entityCount) });
+			}
+		}
+
+		Vector<WorldState> states(batches.Size());
+		for (size_t i = 0; i < batches.Size(); ++i)
+		{
+			WorldState& state = *states.EmplaceBack();
+			state.m_CurrentWorld = this;
+			state.m_DeferActions = true;
+			state.m_OrderKey = i;
+			state.m_FrameState = &worldState;
+
+			//jobs can share a target, so increments are always batched and applied after the jobs, whatever worldState asks for
+			state.m_BatchIncrements = true;
+		}
+
+		JobSystem::Counter counter;
+		for (size_t i = 0; i < batches.Size(); ++i)
+		{
+			jobSystem.Submit([&batches, &states, i]()
+			{
+				const Batch& batch = batches[i];
+				batch.m_Sector->UpdateEntities(states[i], batch.m_Begin, batch.m_End);
+			}, counter);
+		}
+		jobSystem.Wait(counter);
+
+		for (WorldState& state : states)
+		{
+			worldState.Merge(state);
+		}
+
+		worldState.ApplyIncrements();
 		worldState.CreateActions();
+		worldState.DestroyActions();
 		worldState.m_CurrentWorld = nullptr;
 	}
 }
@@ -4,6 +4,7 @@
 #include <string>
 #include "Signature.h"
 #include "WorldState.h"
+#include "JobSystem.h"
 
 
 namespace FieaGameEngine
@@ -85,15 +86,37 @@ namespace FieaGameEngine
 		/// <param name="worldState">the worldstate needed for the update</param>
 		void Update(WorldState& worldState);
 
+		/// <summary>
+		/// calls update on all the sectors in parallel
+		/// each job gets its own copy of the worldstate, so the current sector and entity aren't shared between threads
+		/// actions created or destroyed during the update are held until every job is done, then handled in sector order
+		/// increments are always batched and applied once every job is done, even if worldState doesn't ask for it
+		/// </summary>
+		/// <param name="worldState">the worldstate needed for the update</param>
+		/// <param name="jobSystem">the job system to run the sectors on</param>
+		/// <param name="entityBatchSize">the most entities one job updates, 0 to give every sector a single job</param>
+		void Update(WorldState& worldState, JobSystem& jobSystem, size_t entityBatchSize = 0);
+
 		/// <summary>
 		/// static array that returns the worlds signatures for the type manager
 		/// </summary>
 		/// <returns>the array of signatures</returns>
 		static const Vector<Signature> Signatures();
 
+		/// <summary>
+		/// the slot of m_Name, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_NameSlot = 1;
+
+		/// <summary>
+		/// the slot of m_Sectors, has to match its place in Signatures
+		/// </summary>
+		static constexpr size_t s_SectorsSlot = 2;
+
 	private:
 		/// <summary>
 		/// name of the world
+		/// only read through its datum, since it isn't used when the type is stored in columns
 		/// </summary>
 		std::string m_Name;
 	};
@@ -5,8 +5,15 @@
 
 namespace FieaGameEngine
 {
+	static const Key s_ActionsKey("m_Actions");
+
 	void WorldState::CreateActions()
 	{
+		if (m_DeferActions)
+		{
+			return;
+		}
+
 		for (auto& action : m_CreateList)
 		{
 			assert(action.m_Context != nullptr);
@@ -17,7 +24,7 @@ namespace FieaGameEngine
 				throw std::runtime_error("Factory not found");
 			}
 
-			action.m_Context->Adopt(*newAction, "m_Actions");
+			action.m_Context->Adopt(*newAction, s_ActionsKey);
 			static_cast<Action*>(newAction)->SetName(action.m_ActionName);
 		}
 
@@ -26,6 +33,17 @@ namespace FieaGameEngine
 
 	void WorldState::DestroyActions()
 	{
+		if (m_DeferActions)
+		{
+			return;
+		}
+
+		//batched increments can point into the actions about to be destroyed, so they land before anything is freed
+		if (!m_DestroyList.IsEmpty())
+		{
+			ApplyIncrements();
+		}
+
 		for (auto& action : m_DestroyList)
 		{
 			Scope* currentScope = action.m_Context;
@@ -33,7 +51,7 @@ namespace FieaGameEngine
 
 			while (currentScope != nullptr && !destroyed)
 			{
-				Datum* actions = currentScope->Find("m_Actions");
+				Datum* actions = currentScope->Find(s_ActionsKey);
 
 				if (actions != nullptr)
 				{
@@ -43,8 +61,8 @@ namespace FieaGameEngine
 
 						if (currentAction->Name() == action.m_ActionName)
 						{
+							//deleting it takes it out of its parent's table
 							delete currentAction;
-							actions->Remove(*currentAction);
 							destroyed = true;
 							break;
 						}
@@ -58,6 +76,53 @@ namespace FieaGameEngine
 		m_DestroyList.Clear();
 	}
 
+	void WorldState::Merge(WorldState& other)
+	{
+		for (auto& action : other.m_CreateList)
+		{
+			m_CreateList.PushBack(std::move(action));
+		}
+
+		for (auto& action : other.m_DestroyList)
+		{
+			m_DestroyList.PushBack(std::move(action));
+		}
+
+		for (size_t i = 0; i < other.m_IncrementTargets.Size(); ++i)
+		{
+			m_IncrementTargets.PushBack(other.m_IncrementTargets[i]);
+			m_IncrementSteps.PushBack(other.m_IncrementSteps[i]);
+		}
+
+		other.m_CreateList.Clear();
+		other.m_DestroyList.Clear();
+		other.m_IncrementTargets.Clear();
+		other.m_IncrementSteps.Clear();
+	}
+
+	void WorldState::ApplyIncrements()
+	{
+		if (m_DeferActions || m_IncrementTargets.IsEmpty())
+		{
+			return;
+		}
+
+		assert(m_IncrementTargets.Size() == m_IncrementSteps.Size());
+
+		//two flat arrays and nothing else in the loop, the same target can come up more than once so it stays in order
+		float* const* targets = &m_IncrementTargets.Front();
+		const float* steps = &m_IncrementSteps.Front();
+		size_t count = m_IncrementTargets.Size();
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			*targets[i] += steps[i];
+		}
+
+		m_IncrementTargets.Clear();
+		m_IncrementSteps.Clear();
+	}
+
 	WorldState::ActionInfo::ActionInfo(const std::string& actionName, Scope* context, const std::string& prototype) :
 		m_ActionName(actionName), m_Context(context), m_Prototype(prototype) {}
 }
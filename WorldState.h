@@ -3,6 +3,7 @@
 #include "Stack.h"
 #include <string>
 #include "Scope.h"
+#include "Vector.h"
 
 namespace FieaGameEngine
 {
@@ -49,15 +50,30 @@ namespace FieaGameEngine
 		/// <summary>
 		/// iterates through the list of actions to be created and creates them in the proper context
 		/// empties the list when done
+		/// does nothing while m_DeferActions is set
 		/// </summary>
 		void CreateActions();
 
 		/// <summary>
 		/// iterates through the list of actions to be destroyed and destroys them
+		/// applies any batched increments first if there is anything to destroy, since their targets can be in the actions being destroyed
 		/// clears the list when done
+		/// does nothing while m_DeferActions is set
 		/// </summary>
 		void DestroyActions();
 
+		/// <summary>
+		/// adds every batched increment to its target in one pass, then empties the batch
+		/// does nothing while m_DeferActions is set
+		/// </summary>
+		void ApplyIncrements();
+
+		/// <summary>
+		/// moves another state's create and destroy lists and batched increments onto the end of this one's
+		/// </summary>
+		/// <param name="other">the state to take the lists from, its lists are empty afterwards</param>
+		void Merge(WorldState& other);
+
 		/// <summary>
 		/// the world being processed
 		/// </summary>
@@ -78,6 +94,43 @@ namespace FieaGameEngine
 		/// </summary>
 		Action* m_CurrentAction = nullptr;
 
+		/// <summary>
+		/// when set, created and destroyed actions are held in the lists instead of being handled right away
+		/// set on the states a parallel update hands to each job, so the world can handle them in order once every job is done
+		/// </summary>
+		bool m_DeferActions = false;
+
+		/// <summary>
+		/// the order key for events queued during this update, see EventQueue::Enqueue
+		/// a parallel update gives each job its own so events come out in the same order however the jobs ran
+		/// </summary>
+		size_t m_OrderKey = 0;
+
+		/// <summary>
+		/// the state the parallel update was called with, nullptr for the state itself
+		/// anything that outlives the update, like a queued event, should point at this instead of the job's copy
+		/// </summary>
+		WorldState* m_FrameState = nullptr;
+
+		/// <summary>
+		/// when set, increment actions add their target and step to the batch instead of writing the target right away
+		/// the world applies the batch at the end of its update, so a target doesn't see its increments until the next frame,
+		/// unless actions are destroyed during the update, which applies the batch early
+		/// the parallel world update turns this on for every job whether or not it is set here, so jobs never write the same target at once
+		/// </summary>
+		bool m_BatchIncrements = false;
+
+		/// <summary>
+		/// the targets of the batched increments, a target can show up more than once
+		/// only valid until the end of the update or the next DestroyActions, since the datums they belong to can be changed or destroyed after
+		/// </summary>
+		Vector<float*> m_IncrementTargets;
+
+		/// <summary>
+		/// the steps of the batched increments, lined up with m_IncrementTargets
+		/// </summary>
+		Vector<float> m_IncrementSteps;
+
 		/// <summary>
 		/// list of actions to be created at the end of an update
 		/// </summary>